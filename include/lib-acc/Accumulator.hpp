@@ -10,12 +10,20 @@
 #include <boost/utility.hpp>
 
 // C++ Libraries
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <optional>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 // Project Libraries
 #include "Feature_Utilities.hpp"
@@ -29,14 +37,28 @@ namespace acc {
  * @class Accumulator
  *
  * Stores statistical information about events as events are added.
+ *
+ * @note  Set WEIGHT_TP (ex: double) to enable insert( value, weight ).  Mean, sum and
+ *        variance then become their weighted forms; the rolling and project-specific
+ *        features ignore the weight.
+ * @note  Set MUTEX_TP (ex: Instrumented_Mutex<>) to measure contention on the accumulator
+ *        itself; get_mutex() exposes it.
 */
 template <typename FEATURE_SET = FULL_FEATURE_SET,
-          typename SAMPLE_TP = double >
+          typename SAMPLE_TP = double,
+          typename WEIGHT_TP = void,
+          typename MUTEX_TP = std::mutex >
 class Accumulator final
 {
     public:
 
         typedef FEATURE_SET FEATURE_SET_TP;
+        typedef SAMPLE_TP   SAMPLE_TYPE;
+        typedef WEIGHT_TP   WEIGHT_TYPE;
+        typedef MUTEX_TP    MUTEX_TYPE;
+
+        /// Underlying Boost accumulator set
+        typedef boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP> ACCUMULATOR_SET_TP;
 
         // Small helper function for enabling a function
         template< bool cond, typename U >
@@ -47,19 +69,37 @@ class Accumulator final
          * @note Rolling sum/count/mean accumulators require a window size, so you can't use this method.
         */
         template <typename = std::enable_if<std::negation<std::is_same<FEATURE_SET,ROLLING_FEATURE_SET>>::value>>
-        static Accumulator<FEATURE_SET,SAMPLE_TP> create( const std::string& units )
+        static Accumulator<FEATURE_SET,SAMPLE_TP,WEIGHT_TP,MUTEX_TP> create( const std::string& units )
         {
-            return Accumulator<FEATURE_SET,SAMPLE_TP>( units, 0, false );
+            return Accumulator<FEATURE_SET,SAMPLE_TP,WEIGHT_TP,MUTEX_TP>( units, 0, false );
         }
 
         /**
          * @brief Build a rolling accumulator
         */
         template <typename = std::enable_if<std::is_same<FEATURE_SET,ROLLING_FEATURE_SET>::value>>
-        static Accumulator<FEATURE_SET,SAMPLE_TP> create_rolling( const std::string& units,
+        static Accumulator<FEATURE_SET,SAMPLE_TP,WEIGHT_TP,MUTEX_TP> create_rolling( const std::string& units,
                                                                   size_t             window_size )
         {
-            return Accumulator<FEATURE_SET,SAMPLE_TP>( units, window_size );
+            return Accumulator<FEATURE_SET,SAMPLE_TP,WEIGHT_TP,MUTEX_TP>( units, window_size );
+        }
+
+        /**
+         * @brief Build an accumulator, forwarding named feature parameters to the underlying set
+         * @note  ex:  create_with_params( "ms", acc::reservoir_size = 500 )
+        */
+        template <typename... PARAM_TPS>
+        static Accumulator<FEATURE_SET,SAMPLE_TP,WEIGHT_TP,MUTEX_TP> create_with_params( const std::string& units,
+                                                                      const PARAM_TPS&... params )
+        {
+            if constexpr ( sizeof...(PARAM_TPS) == 0 )
+            {
+                return Accumulator<FEATURE_SET,SAMPLE_TP,WEIGHT_TP,MUTEX_TP>( units, 0, false );
+            }
+            else
+            {
+                return Accumulator<FEATURE_SET,SAMPLE_TP,WEIGHT_TP,MUTEX_TP>( Params_Tag(), units, ( ..., params ) );
+            }
         }
 
         /**
@@ -67,8 +107,8 @@ class Accumulator final
         */
         void insert( SAMPLE_TP new_value )
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
-            m_accumulator( new_value );
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            push( new_value );
             m_last_entry_entered = new_value;
             m_insert_counter++;
             m_rolling_count = std::min( (int64_t)m_rolling_count + 1, (int64_t)m_insert_counter );
@@ -81,10 +121,118 @@ class Accumulator final
             insert( (SAMPLE_TP)duration.count() );
         }
 
+        /**
+         * @brief Add a value along with when it happened, for the rate and time_weighted_mean features
+         * @note  Stored as double seconds since the clock's epoch.  Prefer steady_clock:  against
+         *        system_clock the resolution is about 0.2 us.  Other features ignore the time.
+        */
+        template <typename CLOCK_TP,
+                  typename DURATION_TP>
+        void insert( SAMPLE_TP                                            new_value,
+                     const std::chrono::time_point<CLOCK_TP,DURATION_TP>& timestamp )
+        {
+            const double seconds = std::chrono::duration<double>( timestamp.time_since_epoch() ).count();
+
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            if constexpr ( std::is_void_v<WEIGHT_TP> )
+            {
+                m_accumulator( new_value, acc::sample_time = seconds );
+            }
+            else
+            {
+                m_accumulator( new_value, acc::sample_time = seconds, boost::accumulators::weight = (WEIGHT_TP)1 );
+            }
+            m_last_entry_entered = new_value;
+            m_insert_counter++;
+            m_rolling_count = std::min( (int64_t)m_rolling_count + 1, (int64_t)m_insert_counter );
+        }
+
+        /**
+         * @brief Add a value tagged with where it came from, for the exemplars feature
+         * @note  ex:  insert( elapsed_ms, Exemplar_Context( request_id ) ).  Other features
+         *        ignore the context, and the exemplars feature only copies it when the value
+         *        beats the smallest retained exemplar.
+        */
+        void insert( SAMPLE_TP               new_value,
+                     const Exemplar_Context& context )
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            if constexpr ( std::is_void_v<WEIGHT_TP> )
+            {
+                m_accumulator( new_value, acc::exemplar_context = &context );
+            }
+            else
+            {
+                m_accumulator( new_value, acc::exemplar_context = &context, boost::accumulators::weight = (WEIGHT_TP)1 );
+            }
+            m_last_entry_entered = new_value;
+            m_insert_counter++;
+            m_rolling_count = std::min( (int64_t)m_rolling_count + 1, (int64_t)m_insert_counter );
+        }
+
+        /**
+         * @brief Add a weighted value.  Only available when WEIGHT_TP is set.
+        */
+        template <typename W = WEIGHT_TP,
+                  typename = std::enable_if_t<!std::is_void_v<W>>>
+        void insert( SAMPLE_TP new_value,
+                     W         weight )
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            m_accumulator( new_value, boost::accumulators::weight = weight );
+            m_last_entry_entered = new_value;
+            m_insert_counter++;
+            m_rolling_count = std::min( (int64_t)m_rolling_count + 1, (int64_t)m_insert_counter );
+        }
+
+        /**
+         * @brief Add a value along with a key for the distinct-count feature, ex: a phone number
+         * @note  The key is hashed with std::hash.  Features other than distinct_count ignore it.
+        */
+        template <typename KEY_TP>
+        void insert_with_key( SAMPLE_TP     new_value,
+                              const KEY_TP& key )
+        {
+            const uint64_t key_hash = std::hash<KEY_TP>()( key );
+
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            if constexpr ( std::is_void_v<WEIGHT_TP> )
+            {
+                m_accumulator( new_value, acc::distinct_key = key_hash );
+            }
+            else
+            {
+                m_accumulator( new_value, acc::distinct_key = key_hash, boost::accumulators::weight = (WEIGHT_TP)1 );
+            }
+            m_last_entry_entered = new_value;
+            m_insert_counter++;
+            m_rolling_count = std::min( (int64_t)m_rolling_count + 1, (int64_t)m_insert_counter );
+        }
+
+        /**
+         * @brief Add a batch of values under a single lock
+        */
+        void insert_batch( const SAMPLE_TP* values,
+                           size_t           count )
+        {
+            if( count == 0 )
+            {
+                return;
+            }
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            for( size_t i = 0; i < count; i++ )
+            {
+                push( values[i] );
+            }
+            m_last_entry_entered = values[count-1];
+            m_insert_counter += count;
+            m_rolling_count = std::min( (int64_t)m_rolling_count + (int64_t)count, (int64_t)m_insert_counter );
+        }
+
         /**
          * @brief Get a copy of the underlying accumulator
         */
-        boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET> get_accumulator() const
+        ACCUMULATOR_SET_TP get_accumulator() const
         {
             return m_accumulator;
         }
@@ -92,17 +240,71 @@ class Accumulator final
         /**
          * @brief Get a reference to the underlying accumulator
         */
-        boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& get_accumulator_ref()
+        ACCUMULATOR_SET_TP& get_accumulator_ref()
         {
             return m_accumulator;
         }
 
+        /**
+         * @brief Write the full internal state, including rolling-window contents, to an archive
+         * @note  See Checkpoint.hpp for the versioned file format built on top of this.
+        */
+        template <typename ARCHIVE_TP>
+        void save_state( ARCHIVE_TP& ar ) const
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            const int64_t   insert_counter = m_insert_counter;
+            const int64_t   rolling_count  = m_rolling_count;
+            const SAMPLE_TP last_entry     = m_last_entry_entered;
+            const int32_t   window_size    = m_window_size.value_or( -1 );
+
+            ar << insert_counter << rolling_count << last_entry << window_size << m_units;
+
+            // accumulator_set::serialize() is non-const, but only reads when saving
+            const_cast<ACCUMULATOR_SET_TP&>( m_accumulator ).serialize( ar, ar.version() );
+        }
+
+        /**
+         * @brief Restore state written by save_state().  The feature set and sample type must match.
+         * @param end_offset  Archive offset the state must end at
+         * @note  The accumulator is left untouched if the archive is truncated, invalid, or
+         *        the state does not end at end_offset.
+        */
+        template <typename ARCHIVE_TP>
+        void load_state( ARCHIVE_TP& ar,
+                         size_t      end_offset )
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            int64_t     insert_counter;
+            int64_t     rolling_count;
+            SAMPLE_TP   last_entry;
+            int32_t     window_size;
+            std::string units;
+
+            ar >> insert_counter >> rolling_count >> last_entry >> window_size >> units;
+
+            // Restore into a copy so a throw partway through keeps the current state
+            ACCUMULATOR_SET_TP accumulator( m_accumulator );
+            accumulator.serialize( ar, ar.version() );
+            if( ar.offset() != end_offset )
+            {
+                throw std::runtime_error( "Accumulator state size does not match archive" );
+            }
+
+            m_accumulator        = std::move( accumulator );
+            m_units.swap( units );
+            m_insert_counter     = insert_counter;
+            m_rolling_count      = rolling_count;
+            m_last_entry_entered = last_entry;
+            m_window_size        = ( window_size < 0 ) ? std::optional<int>() : std::optional<int>( window_size );
+        }
+
         /**
          * @brief Get the number of items inserted into the accumulator
         */
         std::optional<int64_t> get_count() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return stats::count( m_accumulator );
         }
 
@@ -111,7 +313,7 @@ class Accumulator final
         */
         bool has_count() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return acc::stats::has_feature<FEATURE_SET,acc::count_stat>::result::value;
         }
 
@@ -121,7 +323,7 @@ class Accumulator final
         */
         std::optional<int64_t> get_rolling_count() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return m_rolling_count;
         }
 
@@ -130,16 +332,24 @@ class Accumulator final
         */
         int64_t number_items_inserted() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return m_insert_counter;
         }
 
+        /**
+         * @brief Access the mutex guarding the accumulator, ex: to read Instrumented_Mutex stats
+        */
+        const MUTEX_TP& get_mutex() const
+        {
+            return m_acc_mtx;
+        }
+
         /**
          * @brief Get the last entry inserted
         */
         SAMPLE_TP last_entry() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return m_last_entry_entered;
         }
 
@@ -148,7 +358,7 @@ class Accumulator final
         */
         std::optional<SAMPLE_TP> get_mean() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return stats::mean( m_accumulator );
         }
 
@@ -157,7 +367,7 @@ class Accumulator final
         */
         bool has_mean() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return acc::stats::has_feature<FEATURE_SET,acc::mean_stat>::result::value;
         }
 
@@ -166,7 +376,7 @@ class Accumulator final
         */
         std::optional<SAMPLE_TP> get_rolling_mean() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return stats::rolling_mean( m_accumulator );
         }
 
@@ -175,7 +385,7 @@ class Accumulator final
         */
         bool has_rolling_mean() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return acc::stats::has_feature<FEATURE_SET,acc::rolling_mean_stat>::result::value;
         }
 
@@ -184,7 +394,7 @@ class Accumulator final
         */
         std::optional<SAMPLE_TP> get_min() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return stats::min( m_accumulator );
         }
 
@@ -193,7 +403,7 @@ class Accumulator final
         */
         bool has_min() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return acc::stats::has_feature<FEATURE_SET,acc::min_stat>::result::value;
         }
 
@@ -202,7 +412,7 @@ class Accumulator final
         */
         std::optional<SAMPLE_TP> get_max() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return stats::max( m_accumulator );
         }
 
@@ -211,7 +421,7 @@ class Accumulator final
         */
         bool has_max() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return acc::stats::has_feature<FEATURE_SET,acc::max_stat>::result::value;
         }
 
@@ -220,7 +430,7 @@ class Accumulator final
         */
         std::optional<SAMPLE_TP> get_variance() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return stats::variance( m_accumulator );
         }
 
@@ -229,7 +439,7 @@ class Accumulator final
         */
         bool has_variance() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return acc::stats::has_feature<FEATURE_SET,acc::variance_stat>::result::value;
         }
 
@@ -238,7 +448,7 @@ class Accumulator final
         */
         std::optional<SAMPLE_TP> get_rolling_variance() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return stats::rolling_variance( m_accumulator );
         }
 
@@ -247,7 +457,7 @@ class Accumulator final
         */
         bool has_rolling_variance() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return acc::stats::has_feature<FEATURE_SET,acc::rolling_variance_stat>::result::value;
         }
 
@@ -256,7 +466,7 @@ class Accumulator final
         */
         std::optional<SAMPLE_TP> get_sum() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return stats::sum( m_accumulator );
         }
 
@@ -265,7 +475,7 @@ class Accumulator final
         */
         bool has_sum() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return acc::stats::has_feature<FEATURE_SET,acc::sum_stat>::result::value;
         }
 
@@ -274,7 +484,7 @@ class Accumulator final
         */
         std::optional<SAMPLE_TP> get_rolling_sum() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return stats::rolling_sum( m_accumulator );
         }
 
@@ -283,10 +493,165 @@ class Accumulator final
         */
         bool has_rolling_sum() const
         {
-            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
             return acc::stats::has_feature<FEATURE_SET,acc::rolling_sum_stat>::result::value;
         }
 
+        /**
+         * @brief Get the CUSUM change-point summary, if enabled
+        */
+        std::optional<Change_Point_Summary> get_cusum() const
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            return stats::cusum( m_accumulator );
+        }
+
+        /**
+         * @brief Check if the CUSUM change-point detector is supported for this accumulator
+        */
+        bool has_cusum() const
+        {
+            return acc::stats::has_feature<FEATURE_SET,acc::cusum_stat>::result::value;
+        }
+
+        /**
+         * @brief Get the Page-Hinkley change-point summary, if enabled
+        */
+        std::optional<Change_Point_Summary> get_page_hinkley() const
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            return stats::page_hinkley( m_accumulator );
+        }
+
+        /**
+         * @brief Check if the Page-Hinkley change-point detector is supported for this accumulator
+        */
+        bool has_page_hinkley() const
+        {
+            return acc::stats::has_feature<FEATURE_SET,acc::page_hinkley_stat>::result::value;
+        }
+
+        /**
+         * @brief Get the estimated number of distinct keys (or values), if enabled
+        */
+        std::optional<double> get_distinct_count() const
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            return stats::distinct_count( m_accumulator );
+        }
+
+        /**
+         * @brief Get a copy of the distinct-count sketch, ex: to merge across accumulators
+        */
+        std::optional<Hyper_Log_Log> get_distinct_sketch() const
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            return stats::distinct_sketch( m_accumulator );
+        }
+
+        /**
+         * @brief Check if the distinct count is supported for this accumulator
+        */
+        bool has_distinct_count() const
+        {
+            return acc::stats::has_feature<FEATURE_SET,acc::distinct_count_stat>::result::value;
+        }
+
+        /**
+         * @brief Get the timestamp-derived event and value rates, if enabled
+        */
+        std::optional<Rate_Summary> get_rate() const
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            return stats::rate( m_accumulator );
+        }
+
+        /**
+         * @brief Check if the rate feature is supported for this accumulator
+        */
+        bool has_rate() const
+        {
+            return acc::stats::has_feature<FEATURE_SET,acc::rate_stat>::result::value;
+        }
+
+        /**
+         * @brief Get the time-weighted mean, once two timestamped samples are apart in time
+        */
+        std::optional<SAMPLE_TP> get_time_weighted_mean() const
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            auto value = stats::time_weighted_mean( m_accumulator );
+            if( !value )
+            {
+                return {};
+            }
+            return (SAMPLE_TP)value.value();
+        }
+
+        /**
+         * @brief Check if the time-weighted mean is supported for this accumulator
+        */
+        bool has_time_weighted_mean() const
+        {
+            return acc::stats::has_feature<FEATURE_SET,acc::time_weighted_mean_stat>::result::value;
+        }
+
+        /**
+         * @brief Get a copy of the retained reservoir samples, if enabled
+        */
+        std::optional<std::vector<SAMPLE_TP>> get_reservoir() const
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            return stats::reservoir( m_accumulator );
+        }
+
+        /**
+         * @brief Check if the reservoir is supported for this accumulator
+        */
+        bool has_reservoir() const
+        {
+            return acc::stats::has_feature<FEATURE_SET,acc::reservoir_stat>::result::value;
+        }
+
+        /**
+         * @brief Get the largest context-tagged samples, largest first, if enabled
+        */
+        std::optional<std::vector<Exemplar>> get_exemplars() const
+        {
+            std::unique_lock<MUTEX_TP> lck(m_acc_mtx);
+            return stats::exemplars( m_accumulator );
+        }
+
+        /**
+         * @brief Check if exemplars are supported for this accumulator
+        */
+        bool has_exemplars() const
+        {
+            return acc::stats::has_feature<FEATURE_SET,acc::exemplars_stat>::result::value;
+        }
+
+        /**
+         * @brief Write the reservoir samples as a single delimited line for offline analysis
+        */
+        void dump_reservoir( std::ostream&       sout,
+                             const std::string&  delimiter = "," ) const
+        {
+            auto samples = get_reservoir();
+            if( !samples )
+            {
+                return;
+            }
+            for( size_t i = 0; i < samples.value().size(); i++ )
+            {
+                if( i > 0 )
+                {
+                    sout << delimiter;
+                }
+                sout << samples.value()[i];
+            }
+            sout << std::endl;
+        }
+
         /**
          * @brief Print to pretty-string
         */
@@ -380,6 +745,81 @@ class Accumulator final
                                                precision );
             }
 
+            if( has_cusum() )
+            {
+                sin << PRINTER::to_log_string( "CUSUM Change Points",
+                                               get_cusum().value().detections,
+                                               "",
+                                               precision );
+            }
+            if( has_page_hinkley() )
+            {
+                sin << PRINTER::to_log_string( "Page-Hinkley Change Points",
+                                               get_page_hinkley().value().detections,
+                                               "",
+                                               precision );
+            }
+
+            if( has_distinct_count() )
+            {
+                sin << PRINTER::to_log_string( "Distinct Count",
+                                               std::llround( get_distinct_count().value() ),
+                                               "",
+                                               precision );
+            }
+
+            if( has_rate() )
+            {
+                auto rate = get_rate().value();
+                sin << PRINTER::to_log_string( "Event Rate",
+                                               rate.event_rate,
+                                               "/s",
+                                               precision );
+                sin << PRINTER::to_log_string( "Windowed Event Rate",
+                                               rate.windowed_event_rate,
+                                               "/s",
+                                               precision );
+                sin << PRINTER::to_log_string( "Value Rate",
+                                               rate.value_rate,
+                                               m_units + "/s",
+                                               precision );
+                sin << PRINTER::to_log_string( "Windowed Value Rate",
+                                               rate.windowed_value_rate,
+                                               m_units + "/s",
+                                               precision );
+            }
+            if( has_time_weighted_mean() )
+            {
+                auto twa = get_time_weighted_mean();
+                if( twa )
+                {
+                    sin << PRINTER::to_log_string( "Time-Weighted Mean",
+                                                   twa.value(),
+                                                   m_units,
+                                                   precision );
+                }
+            }
+
+            if( has_reservoir() )
+            {
+                sin << PRINTER::to_log_string( "Reservoir Size",
+                                               get_reservoir().value().size(),
+                                               "",
+                                               precision );
+            }
+
+            if( has_exemplars() )
+            {
+                auto exemplars = get_exemplars().value();
+                for( size_t i = 0; i < exemplars.size(); i++ )
+                {
+                    sin << PRINTER::to_log_string( "Exemplar " + std::to_string( i + 1 ),
+                                                   exemplars[i].value,
+                                                   m_units + " [" + exemplars[i].context.str() + "]",
+                                                   precision );
+                }
+            }
+
             sin << PRINTER::to_log_string( "Last Entry",
                                            m_last_entry_entered.load(),
                                            m_units,
@@ -391,6 +831,21 @@ class Accumulator final
 
     private:
 
+        /**
+         * @brief Feed one sample to the set.  Unweighted inserts into a weighted set count as weight 1.
+        */
+        void push( SAMPLE_TP new_value )
+        {
+            if constexpr ( std::is_void_v<WEIGHT_TP> )
+            {
+                m_accumulator( new_value );
+            }
+            else
+            {
+                m_accumulator( new_value, boost::accumulators::weight = (WEIGHT_TP)1 );
+            }
+        }
+
         template <typename FEATURE_TP>
         using find_feature_pos = typename boost::mpl::find<FEATURE_SET,FEATURE_TP>::type::pos;
 
@@ -422,6 +877,21 @@ class Accumulator final
         {
         }
 
+        /// Tag to select the named-parameter constructor
+        struct Params_Tag {};
+
+        /**
+         * Constructor (Named feature parameters)
+        */
+        template <typename ARGS_TP>
+        explicit Accumulator( Params_Tag,
+                              const std::string& units,
+                              const ARGS_TP&     args )
+          : m_accumulator( args ),
+            m_units( units )
+        {
+        }
+
         /// Number of items inserted into accumulator
         std::atomic<int64_t> m_insert_counter { 0 };
 
@@ -435,13 +905,13 @@ class Accumulator final
         std::atomic<SAMPLE_TP> m_last_entry_entered;
 
         /// Accumulator Object
-        boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET> m_accumulator;
+        ACCUMULATOR_SET_TP m_accumulator;
 
         /// Unit of measure
         std::string m_units;
 
         /// Access Mutex
-        mutable std::mutex m_acc_mtx;
+        mutable MUTEX_TP m_acc_mtx;
 
 }; // End of Accumulator Class
 
@@ -0,0 +1,358 @@
+/**
+ * @file    Accumulator_Array.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include "Pretty_Printer.hpp"
+#include "Shell_Printer.hpp"
+#include "Summary_Stats.hpp"
+
+namespace acc {
+
+/// Default number of lock stripes in an Accumulator_Array
+constexpr size_t DEFAULT_ARRAY_STRIPE_COUNT = 256;
+
+/**
+ * @class Accumulator_Array
+ *
+ * Fixed set of lightweight accumulators addressed by a dense id, ex: one per customer or
+ * endpoint.  Each entry is only count, sum, sum of squares, min and max (40 bytes), kept in
+ * struct-of-arrays form so 1M entries fit in about 40 MB and report scans walk contiguous
+ * memory.  Ids are split into contiguous blocks that each share one lock, so writers to
+ * different blocks do not contend and a scan takes each lock once.
+ *
+ * Variance comes from the sum of squares, so it loses precision when the mean is large
+ * compared to the spread.  Use a full Accumulator for the few metrics where that matters.
+*/
+template <typename SAMPLE_TP = double>
+class Accumulator_Array final
+{
+    public:
+
+        /**
+         * @brief Create an array of accumulators
+         * @param size         Number of ids, [0, size)
+         * @param units        Unit of measure shared by all entries
+         * @param stripe_count Number of locks the ids are spread over
+        */
+        static Accumulator_Array<SAMPLE_TP> create( size_t             size,
+                                                    const std::string& units,
+                                                    size_t             stripe_count = DEFAULT_ARRAY_STRIPE_COUNT )
+        {
+            return Accumulator_Array<SAMPLE_TP>( size, units, stripe_count );
+        }
+
+        /**
+         * @brief Add a sample to one entry
+         * @throws std::out_of_range if the id is not below size()
+        */
+        void insert( size_t    id,
+                     SAMPLE_TP new_value )
+        {
+            if( id >= m_size )
+            {
+                throw std::out_of_range( "Accumulator_Array id " + std::to_string( id ) + " is out of range." );
+            }
+            const double value = (double)new_value;
+
+            std::unique_lock<std::mutex> lck( m_stripes[id / m_stripe_width].mtx );
+            m_count[id]++;
+            m_sum[id]         += value;
+            m_sum_squares[id] += value * value;
+            m_min[id]          = std::min( m_min[id], value );
+            m_max[id]          = std::max( m_max[id], value );
+        }
+
+        /**
+         * @brief Get the number of entries
+        */
+        size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Approximate memory used by the entries and locks, in bytes
+        */
+        size_t memory_footprint() const
+        {
+            return m_size * ( sizeof(int64_t) + 4 * sizeof(double) )
+                 + m_stripes.size() * sizeof(Stripe);
+        }
+
+        /**
+         * @brief Get the summary of one entry
+        */
+        Summary_Stats get_summary( size_t id ) const
+        {
+            if( id >= m_size )
+            {
+                throw std::out_of_range( "Accumulator_Array id " + std::to_string( id ) + " is out of range." );
+            }
+            std::unique_lock<std::mutex> lck( m_stripes[id / m_stripe_width].mtx );
+            Summary_Stats output;
+            output.count       = m_count[id];
+            output.sum         = m_sum[id];
+            output.sum_squares = m_sum_squares[id];
+            output.min         = m_min[id];
+            output.max         = m_max[id];
+            return output;
+        }
+
+        /**
+         * @brief Get the mean of one entry
+        */
+        std::optional<double> get_mean( size_t id ) const
+        {
+            return get_summary( id ).mean();
+        }
+
+        /**
+         * @brief Get the summary over every sample of every entry
+        */
+        Summary_Stats get_total() const
+        {
+            Summary_Stats output;
+            for( size_t stripe = 0; stripe < m_stripes.size(); stripe++ )
+            {
+                std::unique_lock<std::mutex> lck( m_stripes[stripe].mtx );
+                output.merge( scan( stripe_begin( stripe ), stripe_end( stripe ) ) );
+            }
+            return output;
+        }
+
+        /**
+         * @brief Get the number of entries with at least one sample
+        */
+        size_t get_active_count() const
+        {
+            size_t output = 0;
+            for( size_t stripe = 0; stripe < m_stripes.size(); stripe++ )
+            {
+                std::unique_lock<std::mutex> lck( m_stripes[stripe].mtx );
+                const int64_t* counts = m_count.data();
+                for( size_t id = stripe_begin( stripe ); id < stripe_end( stripe ); id++ )
+                {
+                    output += ( counts[id] > 0 );
+                }
+            }
+            return output;
+        }
+
+        /**
+         * @brief Fold another array of the same size into this one, entry by entry
+         * @note  Stripe layout depends only on size and stripe count, so both must match
+         * @throws std::invalid_argument if the sizes or stripe counts differ
+        */
+        void merge( const Accumulator_Array<SAMPLE_TP>& other )
+        {
+            if( &other == this )
+            {
+                return;
+            }
+            if( other.m_size != m_size || other.m_stripe_width != m_stripe_width )
+            {
+                throw std::invalid_argument( "Accumulator_Array layouts differ, cannot merge." );
+            }
+            for( size_t stripe = 0; stripe < m_stripes.size(); stripe++ )
+            {
+                const size_t begin = stripe_begin( stripe );
+                const size_t end   = stripe_end( stripe );
+                std::scoped_lock lck( m_stripes[stripe].mtx, other.m_stripes[stripe].mtx );
+                for( size_t id = begin; id < end; id++ )
+                {
+                    m_count[id]       += other.m_count[id];
+                    m_sum[id]         += other.m_sum[id];
+                    m_sum_squares[id] += other.m_sum_squares[id];
+                    m_min[id]          = std::min( m_min[id], other.m_min[id] );
+                    m_max[id]          = std::max( m_max[id], other.m_max[id] );
+                }
+            }
+        }
+
+        /**
+         * @brief Print to log string
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            const auto total = get_total();
+
+            std::stringstream sin;
+            sin << PRINTER::to_log_string( "Entries",
+                                           m_size,
+                                           "",
+                                           precision );
+            sin << PRINTER::to_log_string( "Active Entries",
+                                           get_active_count(),
+                                           "",
+                                           precision );
+            sin << PRINTER::to_log_string( "Count",
+                                           total.count,
+                                           "",
+                                           precision );
+            if( total.count == 0 )
+            {
+                return sin.str();
+            }
+            sin << PRINTER::to_log_string( "Mean",
+                                           total.mean().value(),
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "Min",
+                                           total.min,
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "Max",
+                                           total.max,
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "StdDev",
+                                           std::sqrt( total.variance().value() ),
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "Sum",
+                                           total.sum,
+                                           m_units,
+                                           precision );
+            return sin.str();
+        }
+
+    private:
+
+        explicit Accumulator_Array( size_t             size,
+                                    const std::string& units,
+                                    size_t             stripe_count )
+          : m_size( size ),
+            m_stripe_width( std::max<size_t>( ( size + std::max<size_t>( stripe_count, 1 ) - 1 ) / std::max<size_t>( stripe_count, 1 ), 1 ) ),
+            m_stripes( ( size + m_stripe_width - 1 ) / m_stripe_width ),
+            m_count( size, 0 ),
+            m_sum( size, 0 ),
+            m_sum_squares( size, 0 ),
+            m_min( size, std::numeric_limits<double>::infinity() ),
+            m_max( size, -std::numeric_limits<double>::infinity() ),
+            m_units( units )
+        {
+        }
+
+        size_t stripe_begin( size_t stripe ) const
+        {
+            return stripe * m_stripe_width;
+        }
+
+        size_t stripe_end( size_t stripe ) const
+        {
+            return std::min( m_size, ( stripe + 1 ) * m_stripe_width );
+        }
+
+        /**
+         * @brief Summarize a range of ids.  Caller holds the covering lock.
+         *
+         * Each field is folded into SCAN_LANES independent partials which are combined at
+         * the end.  Without -ffast-math the compiler may not reorder one running sum or
+         * min/max, so a single accumulator would serialize on its add latency and never be
+         * vectorized; the lanes give it independent chains to pack into SIMD registers.
+         * Empty entries hold zero sums and infinite min/max, so nothing branches on them.
+        */
+        Summary_Stats scan( size_t begin,
+                            size_t end ) const
+        {
+            const int64_t* counts      = m_count.data();
+            const double*  sums        = m_sum.data();
+            const double*  sum_squares = m_sum_squares.data();
+            const double*  mins        = m_min.data();
+            const double*  maxs        = m_max.data();
+
+            std::array<int64_t,SCAN_LANES> lane_count {};
+            std::array<double,SCAN_LANES>  lane_sum {};
+            std::array<double,SCAN_LANES>  lane_sum_squares {};
+            std::array<double,SCAN_LANES>  lane_min;
+            std::array<double,SCAN_LANES>  lane_max;
+            lane_min.fill( std::numeric_limits<double>::infinity() );
+            lane_max.fill( -std::numeric_limits<double>::infinity() );
+
+            size_t id = begin;
+            for( ; id + SCAN_LANES <= end; id += SCAN_LANES )
+            {
+                for( size_t lane = 0; lane < SCAN_LANES; lane++ )
+                {
+                    lane_count[lane]       += counts[id + lane];
+                    lane_sum[lane]         += sums[id + lane];
+                    lane_sum_squares[lane] += sum_squares[id + lane];
+                    lane_min[lane] = mins[id + lane] < lane_min[lane] ? mins[id + lane] : lane_min[lane];
+                    lane_max[lane] = maxs[id + lane] > lane_max[lane] ? maxs[id + lane] : lane_max[lane];
+                }
+            }
+
+            // Leftover ids go to the leading lanes
+            for( size_t lane = 0; id < end; id++, lane++ )
+            {
+                lane_count[lane]       += counts[id];
+                lane_sum[lane]         += sums[id];
+                lane_sum_squares[lane] += sum_squares[id];
+                lane_min[lane] = std::min( lane_min[lane], mins[id] );
+                lane_max[lane] = std::max( lane_max[lane], maxs[id] );
+            }
+
+            Summary_Stats output;
+            for( size_t lane = 0; lane < SCAN_LANES; lane++ )
+            {
+                output.count       += lane_count[lane];
+                output.sum         += lane_sum[lane];
+                output.sum_squares += lane_sum_squares[lane];
+                output.min = std::min( output.min, lane_min[lane] );
+                output.max = std::max( output.max, lane_max[lane] );
+            }
+            return output;
+        }
+
+        /**
+         * @struct Stripe
+         * One lock per block of ids, padded so neighbouring locks do not share a cache line
+        */
+        struct alignas(64) Stripe
+        {
+            std::mutex mtx;
+        };
+
+        /// Independent partials per field in scan(), two AVX registers of doubles
+        static constexpr size_t SCAN_LANES = 8;
+
+        /// Number of entries
+        size_t m_size;
+
+        /// Number of consecutive ids covered by one stripe
+        size_t m_stripe_width;
+
+        /// Locks, one per block of ids
+        mutable std::vector<Stripe> m_stripes;
+
+        /// Per-entry state, one array per field
+        std::vector<int64_t> m_count;
+        std::vector<double>  m_sum;
+        std::vector<double>  m_sum_squares;
+        std::vector<double>  m_min;
+        std::vector<double>  m_max;
+
+        /// Unit of measure
+        std::string m_units;
+
+}; // End of Accumulator_Array Class
+
+} // End of acc namespace
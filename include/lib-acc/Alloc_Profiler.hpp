@@ -0,0 +1,369 @@
+/**
+ * @file    Alloc_Profiler.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ *
+ * @note  The global operator new/delete hooks are opt-in.  Define ACC_DEFINE_ALLOC_HOOKS
+ *        before including this header in exactly one translation unit of the program.
+ *        Without the hooks the scopes still compile, and every count stays at zero.
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <string>
+
+// Project Libraries
+#include "Accumulator.hpp"
+#include "Print_Utilities.hpp"
+
+namespace acc::alloc {
+
+/**
+ * @struct Alloc_Reading
+ *
+ * Running allocator totals of one thread.  Only grow, so two readings give the activity
+ * in between.
+*/
+struct Alloc_Reading
+{
+    /// Calls to operator new
+    uint64_t allocations { 0 };
+
+    /// Calls to operator delete with a non-null pointer
+    uint64_t frees { 0 };
+
+    /// Bytes requested from operator new
+    uint64_t bytes { 0 };
+
+    /// Time spent inside operator new
+    uint64_t alloc_ns { 0 };
+
+}; // End of Alloc_Reading Struct
+
+namespace detail {
+
+/**
+ * @struct Thread_State
+ *
+ * Per-thread counters written by the hooks.  Constant-initialized, so touching it from
+ * operator new never runs a TLS constructor.
+*/
+struct Thread_State
+{
+    Alloc_Reading totals;
+
+    /// Number of open Alloc_Scope objects on the thread.  Counting is off at zero.
+    int active { 0 };
+
+}; // End of Thread_State Struct
+
+inline thread_local Thread_State t_state;
+
+/**
+ * @brief Call the allocator until it succeeds, running the new_handler like the default
+ *        operator new does.
+*/
+template <typename ALLOCATE_FUNC>
+inline void* allocate_or_throw( ALLOCATE_FUNC allocate_func )
+{
+    void* ptr = nullptr;
+    while( ( ptr = allocate_func() ) == nullptr )
+    {
+        auto handler = std::get_new_handler();
+        if( !handler )
+        {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+    return ptr;
+}
+
+/**
+ * @brief Shared body of every operator new.  Only reads the clock inside an Alloc_Scope.
+*/
+template <typename ALLOCATE_FUNC>
+inline void* allocate( std::size_t size, ALLOCATE_FUNC allocate_func )
+{
+    auto& state = t_state;
+    if( state.active <= 0 )
+    {
+        return allocate_or_throw( allocate_func );
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    void* ptr = allocate_or_throw( allocate_func );
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    state.totals.allocations++;
+    state.totals.bytes    += size;
+    state.totals.alloc_ns += std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count();
+    return ptr;
+}
+
+inline void* allocate( std::size_t size )
+{
+    size = ( size == 0 ) ? 1 : size;
+    return allocate( size, [size](){ return std::malloc( size ); } );
+}
+
+inline void* allocate( std::size_t size, std::align_val_t alignment )
+{
+    const auto align = std::max<std::size_t>( (std::size_t)alignment, sizeof(void*) );
+    const auto padded = ( ( ( size == 0 ) ? 1 : size ) + align - 1 ) / align * align;
+    return allocate( size, [align,padded](){ return std::aligned_alloc( align, padded ); } );
+}
+
+inline void deallocate( void* ptr ) noexcept
+{
+    if( ptr == nullptr )
+    {
+        return;
+    }
+    auto& state = t_state;
+    if( state.active > 0 )
+    {
+        state.totals.frees++;
+    }
+    std::free( ptr );
+}
+
+} // End of detail namespace
+
+/**
+ * @brief Current totals of the calling thread
+*/
+inline Alloc_Reading thread_reading()
+{
+    return detail::t_state.totals;
+}
+
+/**
+ * @class Alloc_Region
+ *
+ * Allocation statistics for one code region:  allocations, frees, bytes and time spent
+ * in operator new per pass, plus the mean latency of a single allocation.  Fed by
+ * Alloc_Scope, safe to share across threads.
+*/
+template <typename FEATURE_SET = FULL_FEATURE_SET>
+class Alloc_Region final
+{
+    public:
+
+        typedef Accumulator<FEATURE_SET,double> ACCUMULATOR_TP;
+
+        static Alloc_Region<FEATURE_SET> create( const std::string& name )
+        {
+            return Alloc_Region<FEATURE_SET>( name );
+        }
+
+        /**
+         * @brief Add one pass through the region
+        */
+        void record( const Alloc_Reading& begin,
+                     const Alloc_Reading& end )
+        {
+            const auto allocations = end.allocations - begin.allocations;
+            const auto alloc_ns    = end.alloc_ns - begin.alloc_ns;
+
+            m_allocations.insert( (double)allocations );
+            m_frees.insert( (double)( end.frees - begin.frees ) );
+            m_bytes.insert( (double)( end.bytes - begin.bytes ) );
+            m_alloc_time.insert( alloc_ns / 1e3 );
+            if( allocations > 0 )
+            {
+                m_alloc_latency.insert( (double)alloc_ns / allocations );
+            }
+        }
+
+        const std::string& name() const
+        {
+            return m_name;
+        }
+
+        /**
+         * @brief Allocations per pass
+        */
+        const ACCUMULATOR_TP& get_allocations() const
+        {
+            return m_allocations;
+        }
+
+        /**
+         * @brief Frees per pass
+        */
+        const ACCUMULATOR_TP& get_frees() const
+        {
+            return m_frees;
+        }
+
+        /**
+         * @brief Bytes requested per pass
+        */
+        const ACCUMULATOR_TP& get_bytes() const
+        {
+            return m_bytes;
+        }
+
+        /**
+         * @brief Time spent in operator new per pass, in us
+        */
+        const ACCUMULATOR_TP& get_alloc_time() const
+        {
+            return m_alloc_time;
+        }
+
+        /**
+         * @brief Mean latency of one allocation, in ns, for each pass that allocated
+        */
+        const ACCUMULATOR_TP& get_alloc_latency() const
+        {
+            return m_alloc_latency;
+        }
+
+        /**
+         * @brief Print the mean and max of every populated statistic
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            acc::print::print_summary<PRINTER>( sin, m_name + " Allocations", m_allocations, "", precision );
+            acc::print::print_summary<PRINTER>( sin, m_name + " Frees", m_frees, "", precision );
+            acc::print::print_summary<PRINTER>( sin, m_name + " Bytes", m_bytes, "B", precision );
+            acc::print::print_summary<PRINTER>( sin, m_name + " Alloc Time", m_alloc_time, "us", precision );
+            acc::print::print_summary<PRINTER>( sin, m_name + " Alloc Latency", m_alloc_latency, "ns", precision );
+            return sin.str();
+        }
+
+    private:
+
+        explicit Alloc_Region( const std::string& name )
+          : m_name( name ),
+            m_allocations( ACCUMULATOR_TP::create( "" ) ),
+            m_frees( ACCUMULATOR_TP::create( "" ) ),
+            m_bytes( ACCUMULATOR_TP::create( "B" ) ),
+            m_alloc_time( ACCUMULATOR_TP::create( "us" ) ),
+            m_alloc_latency( ACCUMULATOR_TP::create( "ns" ) )
+        {
+        }
+
+        /// Region name, used as the report prefix
+        std::string m_name;
+
+        /// Per-pass statistics
+        ACCUMULATOR_TP m_allocations;
+        ACCUMULATOR_TP m_frees;
+        ACCUMULATOR_TP m_bytes;
+        ACCUMULATOR_TP m_alloc_time;
+        ACCUMULATOR_TP m_alloc_latency;
+
+}; // End of Alloc_Region Class
+
+/**
+ * @class Alloc_Counting
+ *
+ * Turns allocation counting on for the calling thread without recording anything.  Take
+ * thread_reading() around one or more guarded blocks and pass both readings to
+ * Alloc_Region::record() later, ex: once a timed region has been stopped.
+*/
+class Alloc_Counting final
+{
+    public:
+
+        Alloc_Counting()
+        {
+            detail::t_state.active++;
+        }
+
+        ~Alloc_Counting()
+        {
+            detail::t_state.active--;
+        }
+
+        Alloc_Counting( const Alloc_Counting& ) = delete;
+        Alloc_Counting& operator = ( const Alloc_Counting& ) = delete;
+
+}; // End of Alloc_Counting Class
+
+/**
+ * @class Alloc_Scope
+ *
+ * Turns allocation counting on for the calling thread and records what the enclosed block
+ * allocated into an Alloc_Region on destruction, ex:
+ *
+ *   { acc::alloc::Alloc_Scope scope( region );  do_work(); }
+ *
+ * Scopes nest.  Allocations made while recording are not counted.
+*/
+template <typename FEATURE_SET = FULL_FEATURE_SET>
+class Alloc_Scope final
+{
+    public:
+
+        explicit Alloc_Scope( Alloc_Region<FEATURE_SET>& region )
+          : m_region( region )
+        {
+            detail::t_state.active++;
+            m_begin = thread_reading();
+        }
+
+        ~Alloc_Scope()
+        {
+            auto end = thread_reading();
+            detail::t_state.active--;
+
+            // Keep an enclosing scope from counting the region's own bookkeeping
+            const int active = detail::t_state.active;
+            detail::t_state.active = 0;
+            m_region.record( m_begin, end );
+            detail::t_state.active = active;
+        }
+
+        Alloc_Scope( const Alloc_Scope& ) = delete;
+        Alloc_Scope& operator = ( const Alloc_Scope& ) = delete;
+
+    private:
+
+        Alloc_Region<FEATURE_SET>& m_region;
+
+        Alloc_Reading m_begin;
+
+}; // End of Alloc_Scope Class
+
+} // End of acc::alloc namespace
+
+#if defined(ACC_DEFINE_ALLOC_HOOKS)
+
+void* operator new( std::size_t size )                                               { return acc::alloc::detail::allocate( size ); }
+void* operator new[]( std::size_t size )                                             { return acc::alloc::detail::allocate( size ); }
+void* operator new( std::size_t size, std::align_val_t align )                       { return acc::alloc::detail::allocate( size, align ); }
+void* operator new[]( std::size_t size, std::align_val_t align )                     { return acc::alloc::detail::allocate( size, align ); }
+
+void* operator new( std::size_t size, const std::nothrow_t& ) noexcept
+{
+    try { return acc::alloc::detail::allocate( size ); } catch( ... ) { return nullptr; }
+}
+void* operator new[]( std::size_t size, const std::nothrow_t& ) noexcept
+{
+    try { return acc::alloc::detail::allocate( size ); } catch( ... ) { return nullptr; }
+}
+
+void operator delete( void* ptr ) noexcept                                           { acc::alloc::detail::deallocate( ptr ); }
+void operator delete[]( void* ptr ) noexcept                                         { acc::alloc::detail::deallocate( ptr ); }
+void operator delete( void* ptr, std::size_t ) noexcept                              { acc::alloc::detail::deallocate( ptr ); }
+void operator delete[]( void* ptr, std::size_t ) noexcept                            { acc::alloc::detail::deallocate( ptr ); }
+void operator delete( void* ptr, std::align_val_t ) noexcept                         { acc::alloc::detail::deallocate( ptr ); }
+void operator delete[]( void* ptr, std::align_val_t ) noexcept                       { acc::alloc::detail::deallocate( ptr ); }
+void operator delete( void* ptr, std::size_t, std::align_val_t ) noexcept            { acc::alloc::detail::deallocate( ptr ); }
+void operator delete[]( void* ptr, std::size_t, std::align_val_t ) noexcept          { acc::alloc::detail::deallocate( ptr ); }
+void operator delete( void* ptr, const std::nothrow_t& ) noexcept                    { acc::alloc::detail::deallocate( ptr ); }
+void operator delete[]( void* ptr, const std::nothrow_t& ) noexcept                  { acc::alloc::detail::deallocate( ptr ); }
+
+#endif
@@ -0,0 +1,371 @@
+/**
+ * @file    Arrival_Monitor.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include "Accumulator.hpp"
+#include "Periodic_Thread.hpp"
+#include "Timing_Accumulator.hpp"
+
+namespace acc {
+
+/**
+ * @class Arrival_Tracker
+ *
+ * Inter-arrival gap statistics for a stream of events.  Gaps go into a Timing_Accumulator
+ * for mean/max and into a log2 histogram of microseconds:  bucket 0 holds gaps under 1 us,
+ * bucket i holds [2^(i-1), 2^i) us, and the last bucket holds everything longer.
+ *
+ * The last arrival is an atomic, so a Stall_Watchdog can read it without locking.
+*/
+class Arrival_Tracker final
+{
+    public:
+
+        typedef std::chrono::steady_clock                 CLOCK_TP;
+        typedef std::chrono::duration<double,std::milli>  DISPLAY_DURATION;
+
+        /// Bucket count.  The last bucket starts at 2^30 us, about 18 minutes.
+        static constexpr size_t NUM_BUCKETS = 32;
+
+        typedef std::array<int64_t,NUM_BUCKETS> HISTOGRAM_TP;
+
+        explicit Arrival_Tracker( const std::string& name = "Arrivals" )
+          : m_name( name ),
+            m_gaps( Timing_Accumulator<DISPLAY_DURATION>::create() )
+        {
+        }
+
+        Arrival_Tracker( const Arrival_Tracker& ) = delete;
+        Arrival_Tracker& operator = ( const Arrival_Tracker& ) = delete;
+
+        /**
+         * @brief Record an arrival.  The first one only starts the clock.
+         * @note  Concurrent callers may see their clock reads land out of order; the
+         *        resulting negative gap is recorded as zero.
+        */
+        void arrive( CLOCK_TP::time_point now = CLOCK_TP::now() )
+        {
+            const int64_t now_ns  = now.time_since_epoch().count();
+            const int64_t prev_ns = m_last_arrival_ns.exchange( now_ns, std::memory_order_relaxed );
+            m_arrivals.fetch_add( 1, std::memory_order_relaxed );
+            if( prev_ns == NO_ARRIVAL )
+            {
+                return;
+            }
+
+            const int64_t gap_ns = std::max<int64_t>( now_ns - prev_ns, 0 );
+            m_gaps.insert_ns( gap_ns );
+            m_histogram[bucket_for( gap_ns )].fetch_add( 1, std::memory_order_relaxed );
+        }
+
+        const std::string& name() const
+        {
+            return m_name;
+        }
+
+        /**
+         * @brief Number of arrivals recorded
+        */
+        int64_t get_arrivals() const
+        {
+            return m_arrivals.load( std::memory_order_relaxed );
+        }
+
+        /**
+         * @brief Time of the last arrival, if any
+        */
+        std::optional<CLOCK_TP::time_point> last_arrival() const
+        {
+            const int64_t last_ns = m_last_arrival_ns.load( std::memory_order_relaxed );
+            if( last_ns == NO_ARRIVAL )
+            {
+                return {};
+            }
+            return CLOCK_TP::time_point( CLOCK_TP::duration( last_ns ) );
+        }
+
+        /**
+         * @brief Gap statistics, in milliseconds
+        */
+        const Timing_Accumulator<DISPLAY_DURATION>& get_gaps() const
+        {
+            return m_gaps;
+        }
+
+        /**
+         * @brief Snapshot of the gap histogram
+        */
+        HISTOGRAM_TP get_histogram() const
+        {
+            HISTOGRAM_TP output;
+            for( size_t i = 0; i < NUM_BUCKETS; i++ )
+            {
+                output[i] = m_histogram[i].load( std::memory_order_relaxed );
+            }
+            return output;
+        }
+
+        /**
+         * @brief Exclusive upper edge of a histogram bucket, in microseconds
+        */
+        static int64_t bucket_upper_bound_us( size_t bucket )
+        {
+            return ( bucket + 1 >= NUM_BUCKETS ) ? std::numeric_limits<int64_t>::max() : ( int64_t( 1 ) << bucket );
+        }
+
+        /**
+         * @brief Print to log string.  Histogram buckets are only printed when non-empty.
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            if( m_gaps.get_count() <= 0 )
+            {
+                return sin.str();
+            }
+            sin << PRINTER::to_log_string( m_name + " Gap Mean", m_gaps.get_mean().value().count(), "ms", precision );
+            sin << PRINTER::to_log_string( m_name + " Gap Max", m_gaps.get_max().value().count(), "ms", precision );
+
+            auto histogram = get_histogram();
+            for( size_t i = 0; i < NUM_BUCKETS; i++ )
+            {
+                if( histogram[i] == 0 )
+                {
+                    continue;
+                }
+                const std::string edge = ( i + 1 >= NUM_BUCKETS ) ? ">=" + std::to_string( int64_t( 1 ) << ( i - 1 ) )
+                                                                  : "<"  + std::to_string( bucket_upper_bound_us( i ) );
+                sin << PRINTER::to_log_string( m_name + " Gap " + edge + " us", histogram[i], "", precision );
+            }
+            return sin.str();
+        }
+
+    private:
+
+        static constexpr int64_t NO_ARRIVAL = std::numeric_limits<int64_t>::min();
+
+        static size_t bucket_for( int64_t gap_ns )
+        {
+            const uint64_t gap_us = (uint64_t)gap_ns / 1000;
+            return std::min<size_t>( std::bit_width( gap_us ), NUM_BUCKETS - 1 );
+        }
+
+        /// Report prefix
+        std::string m_name;
+
+        std::atomic<int64_t> m_last_arrival_ns { NO_ARRIVAL };
+        std::atomic<int64_t> m_arrivals { 0 };
+
+        Timing_Accumulator<DISPLAY_DURATION> m_gaps;
+        std::array<std::atomic<int64_t>,NUM_BUCKETS> m_histogram {};
+
+}; // End of Arrival_Tracker Class
+
+/**
+ * @class Arrival_Accumulator
+ *
+ * An Accumulator which timestamps its own inserts.  One clock read per insert feeds the
+ * Arrival_Tracker and, when FEATURE_SET has rate_stat or time_weighted_mean_stat, those too.
+*/
+template <typename FEATURE_SET = FULL_FEATURE_SET,
+          typename SAMPLE_TP = double>
+class Arrival_Accumulator final
+{
+    public:
+
+        typedef Arrival_Tracker::CLOCK_TP CLOCK_TP;
+
+        /**
+         * @brief Create an arrival-tracking accumulator, forwarding named feature parameters
+        */
+        template <typename... PARAM_TPS>
+        static Arrival_Accumulator<FEATURE_SET,SAMPLE_TP> create( const std::string& name,
+                                                                  const std::string& units,
+                                                                  const PARAM_TPS&... params )
+        {
+            return Arrival_Accumulator<FEATURE_SET,SAMPLE_TP>( name, units, params... );
+        }
+
+        /**
+         * @brief Add a value, recording when it arrived
+        */
+        void insert( SAMPLE_TP new_value )
+        {
+            const auto now = CLOCK_TP::now();
+            m_accumulator.insert( new_value, now );
+            m_tracker.arrive( now );
+        }
+
+        template<typename REP_TYPE,
+                 typename RATIO_TYPE>
+        void insert( const std::chrono::duration<REP_TYPE,RATIO_TYPE>& duration )
+        {
+            insert( (SAMPLE_TP)duration.count() );
+        }
+
+        const Accumulator<FEATURE_SET,SAMPLE_TP>& get_accumulator() const
+        {
+            return m_accumulator;
+        }
+
+        const Arrival_Tracker& get_tracker() const
+        {
+            return m_tracker;
+        }
+
+        /**
+         * @brief Print the values, then the gaps
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            return m_accumulator.template toLogString<PRINTER>( precision ) +
+                   m_tracker.toLogString<PRINTER>( precision );
+        }
+
+    private:
+
+        template <typename... PARAM_TPS>
+        Arrival_Accumulator( const std::string& name,
+                             const std::string& units,
+                             const PARAM_TPS&... params )
+          : m_accumulator( Accumulator<FEATURE_SET,SAMPLE_TP>::create_with_params( units, params... ) ),
+            m_tracker( name )
+        {
+        }
+
+        Accumulator<FEATURE_SET,SAMPLE_TP> m_accumulator;
+        Arrival_Tracker                    m_tracker;
+
+}; // End of Arrival_Accumulator Class
+
+/**
+ * @class Stall_Watchdog
+ *
+ * One Periodic_Thread checking a set of Arrival_Trackers.  When a tracker has been silent for its
+ * threshold the callback fires once, on the watchdog thread; it re-arms on the next arrival.
+ * A tracker with no arrivals yet is timed from when it was watched.
+*/
+class Stall_Watchdog final
+{
+    public:
+
+        typedef Arrival_Tracker::CLOCK_TP CLOCK_TP;
+
+        /// Called with the tracker name and how long it has been silent
+        typedef std::function<void( const std::string&, std::chrono::nanoseconds )> CALLBACK_TP;
+
+        explicit Stall_Watchdog( std::chrono::microseconds period = std::chrono::milliseconds( 100 ) )
+          : m_watchdog( period, [this](){ check(); } )
+        {
+        }
+
+        Stall_Watchdog( const Stall_Watchdog& ) = delete;
+        Stall_Watchdog& operator = ( const Stall_Watchdog& ) = delete;
+
+        ~Stall_Watchdog()
+        {
+            stop();
+        }
+
+        /**
+         * @brief Watch a tracker.  It must outlive the watchdog, or at least stop().
+        */
+        void watch( const Arrival_Tracker&     tracker,
+                    std::chrono::nanoseconds   threshold,
+                    CALLBACK_TP                callback )
+        {
+            std::unique_lock<std::mutex> lck( m_watch_mtx );
+            m_watches.push_back( Watch{ &tracker, threshold, std::move( callback ), CLOCK_TP::now() } );
+        }
+
+        /**
+         * @brief Start the watchdog thread
+        */
+        void start()
+        {
+            m_watchdog.start();
+        }
+
+        /**
+         * @brief Stop the watchdog thread
+        */
+        void stop()
+        {
+            m_watchdog.stop();
+        }
+
+        /**
+         * @brief Check every tracker now, on the calling thread
+        */
+        void check( CLOCK_TP::time_point now = CLOCK_TP::now() )
+        {
+            std::unique_lock<std::mutex> lck( m_watch_mtx );
+            for( auto& watch : m_watches )
+            {
+                const auto last   = watch.tracker->last_arrival().value_or( watch.since );
+                const auto silent = now - last;
+                if( silent < watch.threshold || last == watch.fired_at )
+                {
+                    continue;
+                }
+                watch.fired_at = last;
+                m_stalls.fetch_add( 1, std::memory_order_relaxed );
+                watch.callback( watch.tracker->name(), std::chrono::duration_cast<std::chrono::nanoseconds>( silent ) );
+            }
+        }
+
+        /**
+         * @brief Number of stalls reported
+        */
+        int64_t stall_count() const
+        {
+            return m_stalls.load( std::memory_order_relaxed );
+        }
+
+    private:
+
+        struct Watch
+        {
+            const Arrival_Tracker*   tracker;
+            std::chrono::nanoseconds threshold;
+            CALLBACK_TP              callback;
+
+            /// When watching began
+            CLOCK_TP::time_point since;
+
+            /// Last arrival already reported as stalled
+            CLOCK_TP::time_point fired_at { CLOCK_TP::time_point::min() };
+        };
+
+        std::vector<Watch> m_watches;
+        std::mutex         m_watch_mtx;
+
+        std::atomic<int64_t> m_stalls { 0 };
+
+        /// Watchdog thread, declared last so it stops before the watches go
+        Periodic_Thread m_watchdog;
+
+}; // End of Stall_Watchdog Class
+
+} // End of acc namespace
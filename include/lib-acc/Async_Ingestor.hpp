@@ -0,0 +1,400 @@
+/**
+ * @file    Async_Ingestor.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Project Libraries
+#include "Accumulator.hpp"
+#include "SPSC_Ring.hpp"
+
+namespace acc {
+
+/**
+ * @enum Overflow_Policy
+ *
+ * What a producer does when its ring is full.
+*/
+enum class Overflow_Policy : int
+{
+    DROP  = 0 /*< Discard the sample and count it*/,
+    BLOCK = 1 /*< Spin until the aggregator makes room, or drain inline if it is not running*/,
+};
+
+/**
+ * @class Async_Ingestor
+ *
+ * Moves Accumulator::insert() off the hot path.  Each producer writes raw samples into its
+ * own SPSC ring, and a single aggregator thread drains every ring in batches into the
+ * target accumulators.
+*/
+template <typename SAMPLE_TP = double>
+class Async_Ingestor
+{
+    private:
+
+        /**
+         * Ring plus the accumulator it feeds
+        */
+        struct Channel
+        {
+            Channel( size_t                                              capacity,
+                     std::function<void(const SAMPLE_TP*,size_t)>        sink_func,
+                     std::shared_ptr<const std::atomic<bool>>            running_flag )
+              : ring( capacity ),
+                sink( std::move( sink_func ) ),
+                running( std::move( running_flag ) )
+            {
+            }
+
+            /**
+             * @brief Move up to max_items samples into the sink
+            */
+            size_t drain( size_t max_items )
+            {
+                std::unique_lock<std::mutex> lck( consume_mtx );
+                return ring.consume( sink, max_items );
+            }
+
+            SPSC_Ring<SAMPLE_TP> ring;
+            std::function<void(const SAMPLE_TP*,size_t)> sink;
+            std::atomic<int64_t> dropped { 0 };
+            std::atomic<bool> closed { false };
+
+            /// Aggregator state, shared so producers may outlive the ingestor
+            std::shared_ptr<const std::atomic<bool>> running;
+
+            /// Serializes the consumer side between the aggregator and blocked producers
+            std::mutex consume_mtx;
+        };
+
+    public:
+
+        /**
+         * @class Producer
+         *
+         * Per-thread handle.  Must only be used by one thread at a time.  A default-constructed
+         * or moved-from producer has no ring; check valid() before inserting through one.
+        */
+        class Producer
+        {
+            public:
+
+                Producer() = default;
+
+                Producer( std::shared_ptr<Channel> channel,
+                          Overflow_Policy          policy )
+                  : m_channel( std::move( channel ) ),
+                    m_policy( policy )
+                {
+                }
+
+                Producer( const Producer& ) = delete;
+                Producer& operator = ( const Producer& ) = delete;
+
+                Producer( Producer&& rhs ) = default;
+                Producer& operator = ( Producer&& rhs )
+                {
+                    close();
+                    m_channel = std::move( rhs.m_channel );
+                    m_policy  = rhs.m_policy;
+                    return *this;
+                }
+
+                ~Producer()
+                {
+                    close();
+                }
+
+                /**
+                 * @brief Check if the producer is attached to a ring
+                */
+                bool valid() const
+                {
+                    return m_channel != nullptr;
+                }
+
+                /**
+                 * @brief Queue a sample for the aggregator
+                 * @throws std::logic_error if the producer has no ring
+                */
+                void insert( SAMPLE_TP new_value )
+                {
+                    if( !m_channel )
+                    {
+                        throw std::logic_error( "Async_Ingestor::Producer has no ring" );
+                    }
+                    if( m_channel->ring.try_push( new_value ) )
+                    {
+                        return;
+                    }
+                    if( m_policy == Overflow_Policy::DROP )
+                    {
+                        m_channel->dropped.fetch_add( 1, std::memory_order_relaxed );
+                        return;
+                    }
+                    while( !m_channel->ring.try_push( new_value ) )
+                    {
+                        // Nobody else will make room, so drain on this thread
+                        if( !m_channel->running->load() )
+                        {
+                            m_channel->drain( m_channel->ring.capacity() );
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+
+                template<typename REP_TYPE,
+                         typename RATIO_TYPE>
+                void insert( const std::chrono::duration<REP_TYPE,RATIO_TYPE>& duration )
+                {
+                    insert( (SAMPLE_TP)duration.count() );
+                }
+
+                /**
+                 * @brief Number of samples this producer dropped on overflow, 0 if it has no ring
+                */
+                int64_t dropped() const
+                {
+                    if( !m_channel )
+                    {
+                        return 0;
+                    }
+                    return m_channel->dropped.load( std::memory_order_relaxed );
+                }
+
+            private:
+
+                /// Tell the aggregator it may retire the ring once drained
+                void close()
+                {
+                    if( m_channel )
+                    {
+                        m_channel->closed = true;
+                        m_channel.reset();
+                    }
+                }
+
+                std::shared_ptr<Channel> m_channel;
+
+                Overflow_Policy m_policy { Overflow_Policy::DROP };
+
+        }; // End of Producer Class
+
+        /**
+         * @brief Constructor
+         * @param ring_capacity  Samples buffered per producer
+         * @param policy         Behaviour when a producer's ring is full
+         * @param poll_interval  Aggregator sleep when every ring is empty
+         * @param batch_size     Max samples moved from one ring per pass
+        */
+        explicit Async_Ingestor( size_t                     ring_capacity = 4096,
+                                 Overflow_Policy            policy        = Overflow_Policy::DROP,
+                                 std::chrono::microseconds  poll_interval = std::chrono::milliseconds( 1 ),
+                                 size_t                     batch_size    = 1024 )
+          : m_ring_capacity( ring_capacity ),
+            m_policy( policy ),
+            m_poll_interval( poll_interval ),
+            m_batch_size( batch_size )
+        {
+        }
+
+        Async_Ingestor( const Async_Ingestor& ) = delete;
+        Async_Ingestor& operator = ( const Async_Ingestor& ) = delete;
+
+        ~Async_Ingestor()
+        {
+            stop();
+        }
+
+        /**
+         * @brief Create a producer feeding the given accumulator.
+         * @note  Call once per producer thread.  The accumulator must outlive the ingestor.
+         *        Weighted accumulators get weight 1 per sample.
+        */
+        template <typename FEATURE_SET,
+                  typename WEIGHT_TP,
+                  typename MUTEX_TP>
+        Producer create_producer( Accumulator<FEATURE_SET,SAMPLE_TP,WEIGHT_TP,MUTEX_TP>& accumulator )
+        {
+            auto channel = std::make_shared<Channel>( m_ring_capacity,
+                                                      [&accumulator]( const SAMPLE_TP* values, size_t count ) {
+                                                          accumulator.insert_batch( values, count );
+                                                      },
+                                                      m_running );
+            {
+                std::unique_lock<std::mutex> lck( m_channel_mtx );
+                m_channels.push_back( channel );
+            }
+            return Producer( channel, m_policy );
+        }
+
+        /**
+         * @brief Start the aggregator thread
+        */
+        void start()
+        {
+            if( m_running->exchange( true ) )
+            {
+                return;
+            }
+            m_aggregator = std::thread( [this](){ run(); } );
+        }
+
+        /**
+         * @brief Stop the aggregator thread after draining every ring
+        */
+        void stop()
+        {
+            *m_running = false;
+            if( m_aggregator.joinable() )
+            {
+                m_aggregator.join();
+            }
+        }
+
+        /**
+         * @brief Block until every sample queued before this call has been aggregated
+         * @note  Requires the aggregator to be running.
+        */
+        void flush() const
+        {
+            while( *m_running && pending() > 0 )
+            {
+                std::this_thread::sleep_for( m_poll_interval );
+            }
+        }
+
+        /**
+         * @brief Samples still waiting in rings
+        */
+        size_t pending() const
+        {
+            std::unique_lock<std::mutex> lck( m_channel_mtx );
+            size_t total = 0;
+            for( const auto& channel : m_channels )
+            {
+                total += channel->ring.size();
+            }
+            return total;
+        }
+
+        /**
+         * @brief Samples dropped by every producer, including retired ones
+        */
+        int64_t dropped_count() const
+        {
+            std::unique_lock<std::mutex> lck( m_channel_mtx );
+            int64_t total = m_retired_drops;
+            for( const auto& channel : m_channels )
+            {
+                total += channel->dropped.load( std::memory_order_relaxed );
+            }
+            return total;
+        }
+
+        /**
+         * @brief Number of producer rings currently registered
+        */
+        size_t number_producers() const
+        {
+            std::unique_lock<std::mutex> lck( m_channel_mtx );
+            return m_channels.size();
+        }
+
+    private:
+
+        /**
+         * @brief Aggregator loop
+        */
+        void run()
+        {
+            while( *m_running )
+            {
+                if( drain() == 0 )
+                {
+                    std::this_thread::sleep_for( m_poll_interval );
+                }
+            }
+
+            // Final pass so nothing inserted before stop() is lost
+            while( drain() > 0 ){}
+        }
+
+        /**
+         * @brief One pass over every ring
+         * @return Number of samples aggregated
+        */
+        size_t drain()
+        {
+            std::vector<std::shared_ptr<Channel>> channels;
+            {
+                std::unique_lock<std::mutex> lck( m_channel_mtx );
+                channels = m_channels;
+            }
+
+            size_t total = 0;
+            for( auto& channel : channels )
+            {
+                total += channel->drain( m_batch_size );
+            }
+
+            // Retire rings whose producer is gone and which are fully drained
+            std::unique_lock<std::mutex> lck( m_channel_mtx );
+            for( auto it = m_channels.begin(); it != m_channels.end(); )
+            {
+                if( (*it)->closed && (*it)->ring.empty() )
+                {
+                    m_retired_drops += (*it)->dropped.load( std::memory_order_relaxed );
+                    it = m_channels.erase( it );
+                }
+                else
+                {
+                    it++;
+                }
+            }
+            return total;
+        }
+
+        /// Ring size for new producers
+        size_t m_ring_capacity;
+
+        /// Overflow behaviour for new producers
+        Overflow_Policy m_policy;
+
+        /// Aggregator idle sleep
+        std::chrono::microseconds m_poll_interval;
+
+        /// Max samples per ring per pass
+        size_t m_batch_size;
+
+        /// Registered rings
+        std::vector<std::shared_ptr<Channel>> m_channels;
+
+        /// Drops from rings which have been retired
+        int64_t m_retired_drops { 0 };
+
+        mutable std::mutex m_channel_mtx;
+
+        /// True while the aggregator thread runs
+        std::shared_ptr<std::atomic<bool>> m_running { std::make_shared<std::atomic<bool>>( false ) };
+
+        std::thread m_aggregator;
+
+}; // End of Async_Ingestor Class
+
+} // End of acc namespace
@@ -0,0 +1,245 @@
+/**
+ * @file    Binary_Archive.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ *
+ * @note  Minimal archives compatible with the serialize() members Boost.Accumulators
+ *        already provides.  Values are raw host-endian bytes, so loading is a bounds
+ *        check plus memcpy with no parsing.
+*/
+#pragma once
+
+// Boost Libraries
+#include <boost/mpl/bool.hpp>
+#include <boost/serialization/serialization.hpp>
+
+// Brings in the circular_buffer serialize() overload; it must be declared before the
+// archives below look it up.
+#include <boost/accumulators/statistics/rolling_window.hpp>
+
+// C++ Libraries
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace acc::archive {
+
+namespace detail {
+
+template <typename T>
+struct is_std_vector : std::false_type {};
+
+template <typename T, typename ALLOC_TP>
+struct is_std_vector<std::vector<T,ALLOC_TP>> : std::true_type {};
+
+} // End of detail namespace
+
+/**
+ * @class Binary_Output_Archive
+ *
+ * Appends values to a byte vector.
+*/
+class Binary_Output_Archive
+{
+    public:
+
+        typedef boost::mpl::bool_<true>  is_saving;
+        typedef boost::mpl::bool_<false> is_loading;
+
+        explicit Binary_Output_Archive( std::vector<char>& buffer,
+                                        unsigned int       version )
+          : m_buffer( buffer ),
+            m_version( version )
+        {
+        }
+
+        template <typename T>
+        Binary_Output_Archive& operator << ( const T& value )
+        {
+            save( value );
+            return *this;
+        }
+
+        template <typename T>
+        Binary_Output_Archive& operator & ( const T& value )
+        {
+            save( value );
+            return *this;
+        }
+
+        void save_binary( const void* data,
+                          size_t      size )
+        {
+            const size_t offset = m_buffer.size();
+            m_buffer.resize( offset + size );
+            if( size > 0 )
+            {
+                std::memcpy( m_buffer.data() + offset, data, size );
+            }
+        }
+
+        unsigned int version() const
+        {
+            return m_version;
+        }
+
+    private:
+
+        template <typename T>
+        void save( const T& value )
+        {
+            if constexpr ( std::is_arithmetic_v<T> || std::is_enum_v<T> )
+            {
+                save_binary( &value, sizeof(T) );
+            }
+            else if constexpr ( std::is_same_v<T,std::string> )
+            {
+                save( (uint64_t)value.size() );
+                save_binary( value.data(), value.size() );
+            }
+            else if constexpr ( detail::is_std_vector<T>::value )
+            {
+                save( (uint64_t)value.size() );
+                if constexpr ( std::is_trivially_copyable_v<typename T::value_type> )
+                {
+                    save_binary( value.data(), value.size() * sizeof(typename T::value_type) );
+                }
+                else
+                {
+                    for( const auto& item : value ){ save( item ); }
+                }
+            }
+            else
+            {
+                // Boost serialize() members and free functions don't modify when saving
+                boost::serialization::serialize( *this, const_cast<T&>( value ), m_version );
+            }
+        }
+
+        std::vector<char>& m_buffer;
+
+        unsigned int m_version;
+
+}; // End of Binary_Output_Archive Class
+
+/**
+ * @class Binary_Input_Archive
+ *
+ * Reads values back from a contiguous block, typically a mapped file.
+*/
+class Binary_Input_Archive
+{
+    public:
+
+        typedef boost::mpl::bool_<false> is_saving;
+        typedef boost::mpl::bool_<true>  is_loading;
+
+        Binary_Input_Archive( const char*   data,
+                              size_t        size,
+                              unsigned int  version )
+          : m_data( data ),
+            m_size( size ),
+            m_version( version )
+        {
+        }
+
+        template <typename T>
+        Binary_Input_Archive& operator >> ( T& value )
+        {
+            load( value );
+            return *this;
+        }
+
+        template <typename T>
+        Binary_Input_Archive& operator & ( T& value )
+        {
+            load( value );
+            return *this;
+        }
+
+        void load_binary( void*   data,
+                          size_t  size )
+        {
+            if( size > m_size - m_offset )
+            {
+                throw std::runtime_error( "Binary_Input_Archive: read past end of data" );
+            }
+            if( size > 0 )
+            {
+                std::memcpy( data, m_data + m_offset, size );
+            }
+            m_offset += size;
+        }
+
+        unsigned int version() const
+        {
+            return m_version;
+        }
+
+        /**
+         * @brief Bytes consumed so far
+        */
+        size_t offset() const
+        {
+            return m_offset;
+        }
+
+    private:
+
+        template <typename T>
+        void load( T& value )
+        {
+            if constexpr ( std::is_arithmetic_v<T> || std::is_enum_v<T> )
+            {
+                load_binary( &value, sizeof(T) );
+            }
+            else if constexpr ( std::is_same_v<T,std::string> )
+            {
+                uint64_t size;
+                load( size );
+                if( size > m_size - m_offset )
+                {
+                    throw std::runtime_error( "Binary_Input_Archive: read past end of data" );
+                }
+                value.assign( m_data + m_offset, size );
+                m_offset += size;
+            }
+            else if constexpr ( detail::is_std_vector<T>::value )
+            {
+                uint64_t size;
+                load( size );
+                if constexpr ( std::is_trivially_copyable_v<typename T::value_type> )
+                {
+                    if( size > ( m_size - m_offset ) / sizeof(typename T::value_type) )
+                    {
+                        throw std::runtime_error( "Binary_Input_Archive: read past end of data" );
+                    }
+                    value.resize( size );
+                    load_binary( value.data(), size * sizeof(typename T::value_type) );
+                }
+                else
+                {
+                    value.resize( size );
+                    for( auto& item : value ){ load( item ); }
+                }
+            }
+            else
+            {
+                boost::serialization::serialize( *this, value, m_version );
+            }
+        }
+
+        const char* m_data;
+
+        size_t m_size;
+
+        size_t m_offset { 0 };
+
+        unsigned int m_version;
+
+}; // End of Binary_Input_Archive Class
+
+} // End of acc::archive namespace
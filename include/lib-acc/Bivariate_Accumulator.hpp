@@ -0,0 +1,336 @@
+/**
+ * @file    Bivariate_Accumulator.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+
+// Project Libraries
+#include "Pretty_Printer.hpp"
+#include "Shell_Printer.hpp"
+
+namespace acc {
+
+/**
+ * @class Bivariate_Accumulator
+ *
+ * Tracks paired samples (x, y): per-stream weighted mean and variance, covariance,
+ * correlation and the least-squares line y = intercept + slope * x.  State is a handful
+ * of weighted co-moments updated with West's algorithm, so inserts are O(1), and two
+ * accumulators merge exactly (Chan et al.), ex: per-thread instances combined at report time.
+ *
+ * Weights are treated as frequency weights.
+*/
+class Bivariate_Accumulator final
+{
+    public:
+
+        /**
+         * @brief Create a bivariate accumulator
+         * @param x_units Unit of the x stream
+         * @param y_units Unit of the y stream
+        */
+        static Bivariate_Accumulator create( const std::string& x_units,
+                                             const std::string& y_units )
+        {
+            return Bivariate_Accumulator( x_units, y_units );
+        }
+
+        /**
+         * @brief Add a paired sample.  Non-positive weights are ignored.
+        */
+        void insert( double x,
+                     double y,
+                     double weight = 1 )
+        {
+            if( !( weight > 0 ) )
+            {
+                return;
+            }
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            m_count++;
+            m_weight += weight;
+            const double dx = x - m_mean_x;
+            m_mean_x += dx * weight / m_weight;
+            const double dy = y - m_mean_y;
+            m_mean_y += dy * weight / m_weight;
+            m_m2_x   += weight * dx * ( x - m_mean_x );
+            m_m2_y   += weight * dy * ( y - m_mean_y );
+            m_c_xy   += weight * dx * ( y - m_mean_y );
+        }
+
+        /**
+         * @brief Fold another accumulator's samples into this one
+        */
+        void merge( const Bivariate_Accumulator& other )
+        {
+            if( &other == this )
+            {
+                return;
+            }
+            std::scoped_lock lck( m_acc_mtx, other.m_acc_mtx );
+            if( other.m_count == 0 )
+            {
+                return;
+            }
+
+            const double weight = m_weight + other.m_weight;
+            const double dx     = other.m_mean_x - m_mean_x;
+            const double dy     = other.m_mean_y - m_mean_y;
+            const double scale  = m_weight * other.m_weight / weight;
+
+            m_mean_x += dx * other.m_weight / weight;
+            m_mean_y += dy * other.m_weight / weight;
+            m_m2_x   += other.m_m2_x + dx * dx * scale;
+            m_m2_y   += other.m_m2_y + dy * dy * scale;
+            m_c_xy   += other.m_c_xy + dx * dy * scale;
+            m_weight  = weight;
+            m_count  += other.m_count;
+        }
+
+        /**
+         * @brief Get the number of pairs inserted
+        */
+        int64_t get_count() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_count;
+        }
+
+        /**
+         * @brief Get the sum of weights
+        */
+        double get_total_weight() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_weight;
+        }
+
+        /**
+         * @brief Get the weighted mean of x
+        */
+        std::optional<double> get_mean_x() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_count == 0 )
+            {
+                return {};
+            }
+            return m_mean_x;
+        }
+
+        /**
+         * @brief Get the weighted mean of y
+        */
+        std::optional<double> get_mean_y() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_count == 0 )
+            {
+                return {};
+            }
+            return m_mean_y;
+        }
+
+        /**
+         * @brief Get the (population) variance of x
+        */
+        std::optional<double> get_variance_x() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_count == 0 )
+            {
+                return {};
+            }
+            return m_m2_x / m_weight;
+        }
+
+        /**
+         * @brief Get the (population) variance of y
+        */
+        std::optional<double> get_variance_y() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_count == 0 )
+            {
+                return {};
+            }
+            return m_m2_y / m_weight;
+        }
+
+        /**
+         * @brief Get the (population) covariance of x and y
+        */
+        std::optional<double> get_covariance() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_count == 0 )
+            {
+                return {};
+            }
+            return m_c_xy / m_weight;
+        }
+
+        /**
+         * @brief Get the Pearson correlation, once both streams vary
+        */
+        std::optional<double> get_correlation() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( !( m_m2_x > 0 ) || !( m_m2_y > 0 ) )
+            {
+                return {};
+            }
+            return std::clamp( m_c_xy / std::sqrt( m_m2_x * m_m2_y ), -1.0, 1.0 );
+        }
+
+        /**
+         * @brief Get the slope of the least-squares fit of y on x
+        */
+        std::optional<double> get_slope() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( !( m_m2_x > 0 ) )
+            {
+                return {};
+            }
+            return m_c_xy / m_m2_x;
+        }
+
+        /**
+         * @brief Get the intercept of the least-squares fit of y on x
+        */
+        std::optional<double> get_intercept() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( !( m_m2_x > 0 ) )
+            {
+                return {};
+            }
+            return m_mean_y - ( m_c_xy / m_m2_x ) * m_mean_x;
+        }
+
+        /**
+         * @brief Get the standard error of the slope, once there are 3+ pairs
+        */
+        std::optional<double> get_slope_std_error() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_count < 3 || !( m_m2_x > 0 ) || !( m_weight > 2 ) )
+            {
+                return {};
+            }
+            const double slope = m_c_xy / m_m2_x;
+            const double residual_variance = std::max( m_m2_y - slope * m_c_xy, 0.0 ) / ( m_weight - 2 );
+            return std::sqrt( residual_variance / m_m2_x );
+        }
+
+        /**
+         * @brief Fraction of the variance of y explained by the fit
+        */
+        std::optional<double> get_r_squared() const
+        {
+            auto correlation = get_correlation();
+            if( !correlation )
+            {
+                return {};
+            }
+            return correlation.value() * correlation.value();
+        }
+
+        /**
+         * @brief Print to log string
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            sin << PRINTER::to_log_string( "Count",
+                                           get_count(),
+                                           "",
+                                           precision );
+            if( get_count() == 0 )
+            {
+                return sin.str();
+            }
+
+            sin << PRINTER::to_log_string( "Mean X",
+                                           get_mean_x().value(),
+                                           m_x_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "Mean Y",
+                                           get_mean_y().value(),
+                                           m_y_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "Covariance",
+                                           get_covariance().value(),
+                                           m_x_units + "*" + m_y_units,
+                                           precision );
+
+            auto correlation = get_correlation();
+            if( correlation )
+            {
+                sin << PRINTER::to_log_string( "Correlation",
+                                               correlation.value(),
+                                               "",
+                                               precision );
+            }
+
+            auto slope = get_slope();
+            if( slope )
+            {
+                sin << PRINTER::to_log_string( "Slope",
+                                               slope.value(),
+                                               m_y_units + "/" + m_x_units,
+                                               precision );
+                sin << PRINTER::to_log_string( "Intercept",
+                                               get_intercept().value(),
+                                               m_y_units,
+                                               precision );
+            }
+            return sin.str();
+        }
+
+    private:
+
+        Bivariate_Accumulator( const std::string& x_units,
+                               const std::string& y_units )
+          : m_x_units( x_units ),
+            m_y_units( y_units )
+        {
+        }
+
+        /// Number of pairs
+        int64_t m_count { 0 };
+
+        /// Sum of weights
+        double m_weight { 0 };
+
+        /// Weighted means
+        double m_mean_x { 0 };
+        double m_mean_y { 0 };
+
+        /// Weighted second moments and co-moment about the means
+        double m_m2_x { 0 };
+        double m_m2_y { 0 };
+        double m_c_xy { 0 };
+
+        /// Units of measure
+        std::string m_x_units;
+        std::string m_y_units;
+
+        /// Access Mutex
+        mutable std::mutex m_acc_mtx;
+
+}; // End of Bivariate_Accumulator Class
+
+} // End of acc namespace
@@ -0,0 +1,46 @@
+/**
+ * @file    CPU_Clock.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <chrono>
+#include <ctime>
+
+namespace acc {
+
+/**
+ * @class Basic_CPU_Clock
+ *
+ * std::chrono clock over a POSIX CPU-time clock id.  Only advances while the thread (or
+ * process) is running on a CPU, so time spent blocked on locks, I/O or sleeping is excluded.
+ * Works as the CLOCK_TP of Stopwatch.
+*/
+template <clockid_t CLOCK_ID>
+struct Basic_CPU_Clock
+{
+    typedef std::chrono::nanoseconds               duration;
+    typedef duration::rep                          rep;
+    typedef duration::period                       period;
+    typedef std::chrono::time_point<Basic_CPU_Clock> time_point;
+
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept
+    {
+        timespec ts {};
+        clock_gettime( CLOCK_ID, &ts );
+        return time_point( std::chrono::seconds( ts.tv_sec ) + std::chrono::nanoseconds( ts.tv_nsec ) );
+    }
+
+}; // End of Basic_CPU_Clock Struct
+
+/// CPU time consumed by the calling thread
+typedef Basic_CPU_Clock<CLOCK_THREAD_CPUTIME_ID> Thread_CPU_Clock;
+
+/// CPU time consumed by all threads of the process
+typedef Basic_CPU_Clock<CLOCK_PROCESS_CPUTIME_ID> Process_CPU_Clock;
+
+} // End of acc namespace
@@ -0,0 +1,491 @@
+/**
+ * @file    Change_Point_Feature.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Boost Libraries
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/parameter/keyword.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace acc {
+
+/**
+ * @enum Change_Point_Type
+*/
+enum class Change_Point_Type : int
+{
+    MEAN_INCREASE     = 0,
+    MEAN_DECREASE     = 1,
+    VARIANCE_INCREASE = 2,
+    VARIANCE_DECREASE = 3,
+};
+
+/**
+ * @brief Convert a change-point type to a string
+*/
+inline std::string to_string( Change_Point_Type type )
+{
+    switch( type )
+    {
+        case Change_Point_Type::MEAN_INCREASE:     return "MEAN_INCREASE";
+        case Change_Point_Type::MEAN_DECREASE:     return "MEAN_DECREASE";
+        case Change_Point_Type::VARIANCE_INCREASE: return "VARIANCE_INCREASE";
+        case Change_Point_Type::VARIANCE_DECREASE: return "VARIANCE_DECREASE";
+    }
+    return "UNKNOWN";
+}
+
+/**
+ * @struct Change_Point_Event
+ *
+ * Raised when a detector's statistic crosses its threshold
+*/
+struct Change_Point_Event
+{
+    /// Name of the detector ("CUSUM" or "Page-Hinkley")
+    std::string detector;
+
+    /// Direction of the shift
+    Change_Point_Type type { Change_Point_Type::MEAN_INCREASE };
+
+    /// 1-based index of the sample that triggered the alarm
+    uint64_t sample_index { 0 };
+
+    /// Sample that triggered the alarm
+    double value { 0 };
+
+    /// Baseline the shift was measured against
+    double reference_mean { 0 };
+    double reference_stddev { 0 };
+
+    /// Detector statistic at the alarm
+    double statistic { 0 };
+}; // End of Change_Point_Event Struct
+
+/// Callback fired from insert(), while the accumulator lock is held
+typedef std::function<void(const Change_Point_Event&)> Change_Point_Callback;
+
+/**
+ * @struct Change_Point_Summary
+ *
+ * Result of the change-point features
+*/
+struct Change_Point_Summary
+{
+    /// Alarms raised so far
+    uint64_t detections { 0 };
+
+    /// Most recent alarm
+    std::optional<Change_Point_Event> last_event;
+}; // End of Change_Point_Summary Struct
+
+/// Named parameters.  Drifts and thresholds are in baseline standard deviations; the
+/// variance ratio is the stddev change the CUSUM variance sums are tuned for.
+BOOST_PARAMETER_KEYWORD( tag, change_point_warmup )
+BOOST_PARAMETER_KEYWORD( tag, change_point_callback )
+BOOST_PARAMETER_KEYWORD( tag, cusum_drift )
+BOOST_PARAMETER_KEYWORD( tag, cusum_threshold )
+BOOST_PARAMETER_KEYWORD( tag, cusum_variance_ratio )
+BOOST_PARAMETER_KEYWORD( tag, page_hinkley_delta )
+BOOST_PARAMETER_KEYWORD( tag, page_hinkley_threshold )
+
+/// Samples used to learn the baseline mean/stddev when no change_point_warmup is given
+constexpr uint64_t DEFAULT_CHANGE_POINT_WARMUP = 100;
+
+namespace impl {
+
+/**
+ * @class change_point_base
+ *
+ * Baseline learning, alarm bookkeeping and the callback shared by both detectors.  After
+ * every alarm the baseline is re-learned, so a new regime is not reported again and the
+ * next shift is measured against it.
+*/
+class change_point_base
+{
+    public:
+
+        typedef Change_Point_Summary result_type;
+
+        Change_Point_Summary result( boost::accumulators::dont_care ) const
+        {
+            return m_summary;
+        }
+
+    protected:
+
+        template <typename ARGS>
+        change_point_base( const ARGS& args, const char* name )
+          : m_name( name ),
+            m_warmup( std::max<uint64_t>( args[change_point_warmup | DEFAULT_CHANGE_POINT_WARMUP], 2 ) )
+        {
+            // Boost.Parameter drops lvalue class-type arguments when the default is an rvalue
+            // Copy through a const reference so a moved-in callback is not stolen by the first detector
+            const Change_Point_Callback  no_callback;
+            const Change_Point_Callback& callback = args[change_point_callback | no_callback];
+            m_callback = callback;
+        }
+
+        /**
+         * @brief Feed the baseline estimate
+         * @return True once the baseline is ready and x should go to the detector.  The sample
+         *         that completes the baseline returns false with baseline_ready() set.
+        */
+        bool learn_baseline( double x )
+        {
+            m_seen++;
+            if( m_baseline_count >= m_warmup )
+            {
+                return true;
+            }
+
+            // Welford update
+            m_baseline_count++;
+            const double delta = x - m_baseline_mean;
+            m_baseline_mean += delta / m_baseline_count;
+            m_baseline_m2   += delta * ( x - m_baseline_mean );
+
+            if( m_baseline_count == m_warmup )
+            {
+                m_baseline_stddev = std::sqrt( m_baseline_m2 / ( m_baseline_count - 1 ) );
+
+                // Constant warmup data would make every later change infinitely significant
+                const double floor = std::max( std::abs( m_baseline_mean ) * 1e-3, 1e-12 );
+                m_baseline_stddev = std::max( m_baseline_stddev, floor );
+            }
+            return false;
+        }
+
+        /**
+         * @brief Check if the baseline was learned
+        */
+        bool baseline_ready() const
+        {
+            return m_baseline_count >= m_warmup;
+        }
+
+        /**
+         * @brief Record an alarm and start learning a new baseline
+        */
+        void raise( Change_Point_Type type,
+                    double            value,
+                    double            statistic )
+        {
+            Change_Point_Event event;
+            event.detector         = m_name;
+            event.type             = type;
+            event.sample_index     = m_seen;
+            event.value            = value;
+            event.reference_mean   = m_baseline_mean;
+            event.reference_stddev = m_baseline_stddev;
+            event.statistic        = statistic;
+
+            m_summary.detections++;
+            m_summary.last_event = event;
+
+            m_baseline_count = 0;
+            m_baseline_mean  = 0;
+            m_baseline_m2    = 0;
+
+            if( m_callback )
+            {
+                m_callback( event );
+            }
+        }
+
+        template <typename ARCHIVE_TP>
+        void serialize_base( ARCHIVE_TP& ar )
+        {
+            ar & m_warmup;
+            ar & m_seen;
+            ar & m_baseline_count;
+            ar & m_baseline_mean;
+            ar & m_baseline_m2;
+            ar & m_baseline_stddev;
+            ar & m_summary.detections;
+
+            // Optional last event:  presence flag, then its fields.  Loading emplaces it first.
+            bool has_event = m_summary.last_event.has_value();
+            ar & has_event;
+            if( !has_event )
+            {
+                m_summary.last_event.reset();
+                return;
+            }
+            if( !m_summary.last_event )
+            {
+                m_summary.last_event.emplace();
+            }
+            auto& event = m_summary.last_event.value();
+            ar & event.detector;
+            ar & event.type;
+            ar & event.sample_index;
+            ar & event.value;
+            ar & event.reference_mean;
+            ar & event.reference_stddev;
+            ar & event.statistic;
+        }
+
+        /// Detector name for events
+        const char* m_name;
+
+        /// Samples used to learn a baseline
+        uint64_t m_warmup;
+
+        /// Samples seen
+        uint64_t m_seen { 0 };
+
+        /// Baseline estimate
+        uint64_t m_baseline_count { 0 };
+        double m_baseline_mean { 0 };
+        double m_baseline_m2 { 0 };
+        double m_baseline_stddev { 1 };
+
+        /// Alarm history
+        Change_Point_Summary m_summary;
+
+        /// User callback
+        Change_Point_Callback m_callback;
+
+}; // End of change_point_base Class
+
+/**
+ * @struct cusum_impl
+ *
+ * Two-sided tabular CUSUM on the standardized sample z for mean shifts, plus
+ * log-likelihood-ratio CUSUMs on z^2 for the stddev growing or shrinking by
+ * cusum_variance_ratio.  Four running sums, O(1) per insert.
+*/
+template <typename SAMPLE_TP>
+struct cusum_impl : boost::accumulators::accumulator_base,
+                    change_point_base
+{
+    template <typename ARGS>
+    cusum_impl( const ARGS& args )
+      : change_point_base( args, "CUSUM" ),
+        m_drift( args[cusum_drift | 0.5] ),
+        m_threshold( args[cusum_threshold | 12.0] )
+    {
+        const double ratio = std::max<double>( args[cusum_variance_ratio | 2.0], 1.0 + 1e-6 );
+        m_var_high_scale = 0.5 * ( 1.0 - 1.0 / ( ratio * ratio ) );
+        m_var_low_scale  = 0.5 * ( ratio * ratio - 1.0 );
+        m_log_ratio      = std::log( ratio );
+    }
+
+    using change_point_base::result_type;
+    using change_point_base::result;
+
+    template <typename ARGS>
+    void operator()( const ARGS& args )
+    {
+        const double x = (double)args[boost::accumulators::sample];
+        if( !learn_baseline( x ) )
+        {
+            if( baseline_ready() )
+            {
+                reset();
+            }
+            return;
+        }
+
+        const double z  = ( x - m_baseline_mean ) / m_baseline_stddev;
+        const double z2 = z * z;
+
+        m_mean_high = std::max( 0.0, m_mean_high + z - m_drift );
+        m_mean_low  = std::max( 0.0, m_mean_low  - z - m_drift );
+        m_var_high  = std::max( 0.0, m_var_high  + z2 * m_var_high_scale - m_log_ratio );
+        m_var_low   = std::max( 0.0, m_var_low   - z2 * m_var_low_scale  + m_log_ratio );
+
+        // A mean shift also inflates z^2.  When the variance sum trips while a mean sum has
+        // grown comparably, the samples are consistently on one side, so report the mean shift.
+        const bool variance_alarm = m_var_high > m_threshold;
+        if( m_mean_high > m_threshold ||
+            ( variance_alarm && m_mean_high > 0.5 * m_var_high ) )
+        {
+            raise( Change_Point_Type::MEAN_INCREASE, x, m_mean_high );
+        }
+        else if( m_mean_low > m_threshold ||
+                 ( variance_alarm && m_mean_low > 0.5 * m_var_high ) )
+        {
+            raise( Change_Point_Type::MEAN_DECREASE, x, m_mean_low );
+        }
+        else if( variance_alarm ) { raise( Change_Point_Type::VARIANCE_INCREASE, x, m_var_high ); }
+        else if( m_var_low > m_threshold )  { raise( Change_Point_Type::VARIANCE_DECREASE, x, m_var_low ); }
+    }
+
+    template <typename ARCHIVE_TP>
+    void serialize( ARCHIVE_TP& ar, const unsigned int version )
+    {
+        serialize_base( ar );
+        ar & m_drift;
+        ar & m_var_high_scale;
+        ar & m_var_low_scale;
+        ar & m_log_ratio;
+        ar & m_threshold;
+        ar & m_mean_high;
+        ar & m_mean_low;
+        ar & m_var_high;
+        ar & m_var_low;
+    }
+
+    private:
+
+        /**
+         * @brief Clear the detector statistics for a new baseline
+        */
+        void reset()
+        {
+            m_mean_high = m_mean_low = m_var_high = m_var_low = 0;
+        }
+
+        /// Allowed slack (k) and decision interval (h)
+        double m_drift;
+        double m_threshold;
+
+        /// Likelihood-ratio terms for the variance sums
+        double m_var_high_scale;
+        double m_var_low_scale;
+        double m_log_ratio;
+
+        /// Running sums
+        double m_mean_high { 0 };
+        double m_mean_low { 0 };
+        double m_var_high { 0 };
+        double m_var_low { 0 };
+
+}; // End of cusum_impl
+
+/**
+ * @struct page_hinkley_impl
+ *
+ * Two-sided Page-Hinkley test.  Accumulates deviations from the running mean of the
+ * current regime and alarms when the cumulative sum rises (or falls) more than the
+ * threshold above its historical extreme.  Detects mean shifts only.
+*/
+template <typename SAMPLE_TP>
+struct page_hinkley_impl : boost::accumulators::accumulator_base,
+                           change_point_base
+{
+    template <typename ARGS>
+    page_hinkley_impl( const ARGS& args )
+      : change_point_base( args, "Page-Hinkley" ),
+        m_delta( args[page_hinkley_delta | 0.5] ),
+        m_threshold( args[page_hinkley_threshold | 15.0] )
+    {
+    }
+
+    using change_point_base::result_type;
+    using change_point_base::result;
+
+    template <typename ARGS>
+    void operator()( const ARGS& args )
+    {
+        const double x = (double)args[boost::accumulators::sample];
+        if( !learn_baseline( x ) )
+        {
+            if( baseline_ready() )
+            {
+                reset();
+            }
+            return;
+        }
+
+        m_count++;
+        m_mean += ( x - m_mean ) / m_count;
+        const double z = ( x - m_mean ) / m_baseline_stddev;
+
+        m_sum_high += z - m_delta;
+        m_min_high  = std::min( m_min_high, m_sum_high );
+        m_sum_low  += z + m_delta;
+        m_max_low   = std::max( m_max_low, m_sum_low );
+
+        if( m_sum_high - m_min_high > m_threshold )
+        {
+            raise( Change_Point_Type::MEAN_INCREASE, x, m_sum_high - m_min_high );
+        }
+        else if( m_max_low - m_sum_low > m_threshold )
+        {
+            raise( Change_Point_Type::MEAN_DECREASE, x, m_max_low - m_sum_low );
+        }
+    }
+
+    template <typename ARCHIVE_TP>
+    void serialize( ARCHIVE_TP& ar, const unsigned int version )
+    {
+        serialize_base( ar );
+        ar & m_delta;
+        ar & m_threshold;
+        ar & m_count;
+        ar & m_mean;
+        ar & m_sum_high;
+        ar & m_min_high;
+        ar & m_sum_low;
+        ar & m_max_low;
+    }
+
+    private:
+
+        /**
+         * @brief Clear the detector statistics for a new baseline
+        */
+        void reset()
+        {
+            m_count = 0;
+            m_mean  = m_baseline_mean;
+            m_sum_high = m_min_high = 0;
+            m_sum_low  = m_max_low  = 0;
+        }
+
+        /// Tolerated drift per sample and alarm threshold
+        double m_delta;
+        double m_threshold;
+
+        /// Running mean of the current regime
+        uint64_t m_count { 0 };
+        double m_mean { 0 };
+
+        /// Cumulative sums and their extremes
+        double m_sum_high { 0 };
+        double m_min_high { 0 };
+        double m_sum_low { 0 };
+        double m_max_low { 0 };
+
+}; // End of page_hinkley_impl
+
+} // End of impl namespace
+
+namespace tag {
+
+/**
+ * @struct cusum
+ * Feature tag for the CUSUM change-point detector
+*/
+struct cusum : boost::accumulators::depends_on<>
+{
+    typedef acc::impl::cusum_impl<boost::mpl::_1> impl;
+};
+
+/**
+ * @struct page_hinkley
+ * Feature tag for the Page-Hinkley change-point detector
+*/
+struct page_hinkley : boost::accumulators::depends_on<>
+{
+    typedef acc::impl::page_hinkley_impl<boost::mpl::_1> impl;
+};
+
+} // End of tag namespace
+
+} // End of acc namespace
@@ -0,0 +1,421 @@
+/**
+ * @file    Checkpoint.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ *
+ * @note  Checkpoint layout (host-endian):
+ *
+ *        Single accumulator:   [Checkpoint_Header][payload]
+ *        Checkpoint file:      [File_Header] then per entry
+ *                              [uint32 name length][name][Checkpoint_Header][payload]
+ *
+ *        Payloads come from Accumulator::save_state() through Binary_Output_Archive, so
+ *        moments are raw words and rolling windows are written as one block copy.
+ *
+ * @note  The header carries a fingerprint of the accumulator type, so a payload is only
+ *        restored into the same sample type, weight and feature set that wrote it.  The
+ *        fingerprint hashes the compiler's spelling of that type, so checkpoints are tied
+ *        to a compiler as well as to the host byte order.
+*/
+#pragma once
+
+// C++ Libraries
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// POSIX Libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Project Libraries
+#include "Binary_Archive.hpp"
+
+namespace acc::checkpoint {
+
+/// Bumped whenever the payload layout changes
+constexpr uint32_t FORMAT_VERSION = 2;
+
+namespace detail {
+
+/**
+ * @brief 64-bit FNV-1a hash
+*/
+constexpr uint64_t fnv1a( std::string_view text )
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for( char c : text )
+    {
+        hash ^= (uint8_t)c;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Function signature naming T, as spelled by the compiler
+*/
+template <typename T>
+constexpr std::string_view type_signature()
+{
+    return __PRETTY_FUNCTION__;
+}
+
+} // End of detail namespace
+
+/**
+ * @brief Fingerprint of the state an accumulator writes.  For an Accumulator this covers
+ *        the underlying Boost set (sample type, feature set and weight) but not the mutex.
+*/
+template <typename ACCUMULATOR_TP>
+constexpr uint64_t layout_fingerprint()
+{
+    if constexpr ( requires { typename ACCUMULATOR_TP::ACCUMULATOR_SET_TP; } )
+    {
+        return detail::fnv1a( detail::type_signature<typename ACCUMULATOR_TP::ACCUMULATOR_SET_TP>() );
+    }
+    else
+    {
+        return detail::fnv1a( detail::type_signature<ACCUMULATOR_TP>() );
+    }
+}
+
+/**
+ * @struct Checkpoint_Header
+ *
+ * Prefix of every serialized accumulator
+*/
+struct Checkpoint_Header
+{
+    char     magic[4] { 'A', 'C', 'C', 'K' };
+    uint32_t version { FORMAT_VERSION };
+    uint32_t sample_size { 0 };
+    uint32_t reserved { 0 };
+    uint64_t fingerprint { 0 };
+    uint64_t payload_size { 0 };
+}; // End of Checkpoint_Header Struct
+
+/**
+ * @struct File_Header
+ *
+ * Prefix of a multi-accumulator checkpoint file
+*/
+struct File_Header
+{
+    char     magic[4] { 'A', 'C', 'C', 'F' };
+    uint32_t version { FORMAT_VERSION };
+    uint64_t entry_count { 0 };
+}; // End of File_Header Struct
+
+/**
+ * @brief Append a checkpoint of the accumulator to buffer
+*/
+template <typename ACCUMULATOR_TP>
+void serialize( const ACCUMULATOR_TP& accumulator,
+                std::vector<char>&    buffer )
+{
+    const size_t header_offset = buffer.size();
+    buffer.resize( header_offset + sizeof(Checkpoint_Header) );
+
+    archive::Binary_Output_Archive ar( buffer, FORMAT_VERSION );
+    accumulator.save_state( ar );
+
+    Checkpoint_Header header;
+    header.sample_size  = sizeof(typename ACCUMULATOR_TP::SAMPLE_TYPE);
+    header.fingerprint  = layout_fingerprint<ACCUMULATOR_TP>();
+    header.payload_size = buffer.size() - header_offset - sizeof(Checkpoint_Header);
+    std::memcpy( buffer.data() + header_offset, &header, sizeof(header) );
+}
+
+/**
+ * @brief Checkpoint the accumulator into a new buffer
+*/
+template <typename ACCUMULATOR_TP>
+std::vector<char> serialize( const ACCUMULATOR_TP& accumulator )
+{
+    std::vector<char> buffer;
+    serialize( accumulator, buffer );
+    return buffer;
+}
+
+/**
+ * @brief Restore an accumulator from a checkpoint
+ * @return Bytes consumed, header included
+ * @throws std::runtime_error if the data is truncated, was written by another format or
+ *         accumulator type, or its payload size does not match what was restored.  The
+ *         accumulator is left untouched when this throws.
+*/
+template <typename ACCUMULATOR_TP>
+size_t deserialize( ACCUMULATOR_TP& accumulator,
+                    const char*     data,
+                    size_t          size )
+{
+    Checkpoint_Header header;
+    if( size < sizeof(header) )
+    {
+        throw std::runtime_error( "Checkpoint truncated" );
+    }
+    std::memcpy( &header, data, sizeof(header) );
+
+    if( std::memcmp( header.magic, Checkpoint_Header().magic, sizeof(header.magic) ) != 0 )
+    {
+        throw std::runtime_error( "Not an accumulator checkpoint" );
+    }
+    if( header.version != FORMAT_VERSION )
+    {
+        throw std::runtime_error( "Unsupported checkpoint version " + std::to_string( header.version ) );
+    }
+    if( header.sample_size != sizeof(typename ACCUMULATOR_TP::SAMPLE_TYPE) )
+    {
+        throw std::runtime_error( "Checkpoint sample type does not match accumulator" );
+    }
+    if( header.fingerprint != layout_fingerprint<ACCUMULATOR_TP>() )
+    {
+        throw std::runtime_error( "Checkpoint feature set does not match accumulator" );
+    }
+    if( header.payload_size > size - sizeof(header) )
+    {
+        throw std::runtime_error( "Checkpoint truncated" );
+    }
+
+    archive::Binary_Input_Archive ar( data + sizeof(header), header.payload_size, header.version );
+    accumulator.load_state( ar, header.payload_size );
+    return sizeof(header) + header.payload_size;
+}
+
+template <typename ACCUMULATOR_TP>
+size_t deserialize( ACCUMULATOR_TP&          accumulator,
+                    const std::vector<char>& buffer )
+{
+    return deserialize( accumulator, buffer.data(), buffer.size() );
+}
+
+/**
+ * @class Checkpoint_Writer
+ *
+ * Collects named accumulator checkpoints and writes them to one file
+*/
+class Checkpoint_Writer
+{
+    public:
+
+        Checkpoint_Writer()
+        {
+            m_buffer.resize( sizeof(File_Header) );
+        }
+
+        /**
+         * @brief Snapshot an accumulator under the given name
+        */
+        template <typename ACCUMULATOR_TP>
+        void add( const std::string&    name,
+                  const ACCUMULATOR_TP& accumulator )
+        {
+            const uint32_t name_size = name.size();
+            const size_t offset = m_buffer.size();
+            m_buffer.resize( offset + sizeof(name_size) + name_size );
+            std::memcpy( m_buffer.data() + offset, &name_size, sizeof(name_size) );
+            std::memcpy( m_buffer.data() + offset + sizeof(name_size), name.data(), name_size );
+
+            serialize( accumulator, m_buffer );
+            m_entry_count++;
+        }
+
+        /**
+         * @brief Number of accumulators added
+        */
+        size_t size() const
+        {
+            return m_entry_count;
+        }
+
+        /**
+         * @brief Write every entry to path, replacing it
+        */
+        void write( const std::string& path )
+        {
+            File_Header header;
+            header.entry_count = m_entry_count;
+            std::memcpy( m_buffer.data(), &header, sizeof(header) );
+
+            const std::string tmp_path = path + ".tmp";
+            {
+                std::ofstream fout( tmp_path, std::ios::binary | std::ios::trunc );
+                fout.write( m_buffer.data(), m_buffer.size() );
+                if( !fout )
+                {
+                    throw std::runtime_error( "Unable to write checkpoint " + tmp_path );
+                }
+            }
+
+            // Rename so a crash mid-write never leaves a partial checkpoint behind
+            if( std::rename( tmp_path.c_str(), path.c_str() ) != 0 )
+            {
+                throw std::runtime_error( "Unable to replace checkpoint " + path );
+            }
+        }
+
+    private:
+
+        /// File contents
+        std::vector<char> m_buffer;
+
+        /// Entries added
+        size_t m_entry_count { 0 };
+
+}; // End of Checkpoint_Writer Class
+
+/**
+ * @class Checkpoint_Reader
+ *
+ * Memory-maps a checkpoint file and indexes entries by name.  Restoring an accumulator
+ * reads straight out of the mapping.
+*/
+class Checkpoint_Reader
+{
+    public:
+
+        explicit Checkpoint_Reader( const std::string& path )
+        {
+            int fd = ::open( path.c_str(), O_RDONLY );
+            if( fd < 0 )
+            {
+                throw std::runtime_error( "Unable to open checkpoint " + path );
+            }
+
+            struct stat info;
+            if( ::fstat( fd, &info ) != 0 || (size_t)info.st_size < sizeof(File_Header) )
+            {
+                ::close( fd );
+                throw std::runtime_error( "Invalid checkpoint " + path );
+            }
+            m_size = info.st_size;
+
+            void* mapping = ::mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            ::close( fd );
+            if( mapping == MAP_FAILED )
+            {
+                throw std::runtime_error( "Unable to map checkpoint " + path );
+            }
+            m_data = static_cast<const char*>( mapping );
+
+            try
+            {
+                build_index();
+            }
+            catch( ... )
+            {
+                ::munmap( const_cast<char*>( m_data ), m_size );
+                throw;
+            }
+        }
+
+        Checkpoint_Reader( const Checkpoint_Reader& ) = delete;
+        Checkpoint_Reader& operator = ( const Checkpoint_Reader& ) = delete;
+
+        ~Checkpoint_Reader()
+        {
+            ::munmap( const_cast<char*>( m_data ), m_size );
+        }
+
+        /**
+         * @brief Check if an entry exists
+        */
+        bool contains( const std::string& name ) const
+        {
+            return m_index.find( name ) != m_index.end();
+        }
+
+        /**
+         * @brief Names of every entry
+        */
+        std::vector<std::string> names() const
+        {
+            std::vector<std::string> output;
+            for( const auto& entry : m_index )
+            {
+                output.emplace_back( entry.first );
+            }
+            return output;
+        }
+
+        /**
+         * @brief Restore the named entry into accumulator
+         * @return False if no entry has that name
+        */
+        template <typename ACCUMULATOR_TP>
+        bool restore( const std::string& name,
+                      ACCUMULATOR_TP&    accumulator ) const
+        {
+            auto it = m_index.find( name );
+            if( it == m_index.end() )
+            {
+                return false;
+            }
+            deserialize( accumulator, m_data + it->second.first, it->second.second );
+            return true;
+        }
+
+    private:
+
+        /**
+         * @brief Walk the entry headers once.  Payloads are only touched on restore().
+        */
+        void build_index()
+        {
+            File_Header header;
+            std::memcpy( &header, m_data, sizeof(header) );
+            if( std::memcmp( header.magic, File_Header().magic, sizeof(header.magic) ) != 0 ||
+                header.version != FORMAT_VERSION )
+            {
+                throw std::runtime_error( "Unsupported checkpoint file" );
+            }
+
+            size_t offset = sizeof(header);
+            for( uint64_t i = 0; i < header.entry_count; i++ )
+            {
+                uint32_t name_size;
+                if( m_size - offset < sizeof(name_size) )
+                {
+                    throw std::runtime_error( "Checkpoint file truncated" );
+                }
+                std::memcpy( &name_size, m_data + offset, sizeof(name_size) );
+                offset += sizeof(name_size);
+
+                Checkpoint_Header entry;
+                if( m_size - offset < (size_t)name_size + sizeof(entry) )
+                {
+                    throw std::runtime_error( "Checkpoint file truncated" );
+                }
+                std::string name( m_data + offset, name_size );
+                offset += name_size;
+
+                std::memcpy( &entry, m_data + offset, sizeof(entry) );
+                const size_t entry_size = sizeof(entry) + entry.payload_size;
+                if( entry.payload_size > m_size - offset - sizeof(entry) )
+                {
+                    throw std::runtime_error( "Checkpoint file truncated" );
+                }
+                m_index[name] = std::make_pair( offset, entry_size );
+                offset += entry_size;
+            }
+        }
+
+        /// Mapped file
+        const char* m_data { nullptr };
+        size_t m_size { 0 };
+
+        /// Entry name -> (offset, size)
+        std::map<std::string,std::pair<size_t,size_t>> m_index;
+
+}; // End of Checkpoint_Reader Class
+
+} // End of acc::checkpoint namespace
@@ -0,0 +1,229 @@
+/**
+ * @file    Complexity_Estimator.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Boost Libraries
+#include <boost/math/distributions/students_t.hpp>
+
+// C++ Libraries
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+
+// Project Libraries
+#include "Bivariate_Accumulator.hpp"
+#include "Pretty_Printer.hpp"
+#include "Shell_Printer.hpp"
+
+namespace acc {
+
+/**
+ * @class Complexity_Estimator
+ *
+ * Fits cost = a * size^k from (problem size, cost) pairs with a streaming least-squares
+ * fit in log-log space.  The slope k is the empirical complexity exponent: ~1 for O(n),
+ * ~2 for O(n^2), and ~1.1 for O(n log n) over typical ranges.  The fit is a
+ * Bivariate_Accumulator over (log size, log cost), so memory and per-insert cost are
+ * constant and estimators merge.
+*/
+class Complexity_Estimator final
+{
+    public:
+
+        /**
+         * @brief Create an estimator
+         * @param units Unit of the cost values (only used for reporting)
+        */
+        static Complexity_Estimator create( const std::string& units )
+        {
+            return Complexity_Estimator( units );
+        }
+
+        /**
+         * @brief Add a (problem size, cost) pair.  Non-positive values have no logarithm and are skipped.
+        */
+        void insert( double problem_size,
+                     double cost )
+        {
+            if( !( problem_size > 0 ) || !( cost > 0 ) )
+            {
+                return;
+            }
+            m_fit.insert( std::log( problem_size ), std::log( cost ) );
+        }
+
+        template<typename REP_TYPE,
+                 typename RATIO_TYPE>
+        void insert( double                                        problem_size,
+                     const std::chrono::duration<REP_TYPE,RATIO_TYPE>& duration )
+        {
+            insert( problem_size, (double)duration.count() );
+        }
+
+        /**
+         * @brief Fold another estimator's samples into this one
+        */
+        void merge( const Complexity_Estimator& other )
+        {
+            m_fit.merge( other.m_fit );
+        }
+
+        /**
+         * @brief Get the number of pairs used in the fit
+        */
+        int64_t get_count() const
+        {
+            return m_fit.get_count();
+        }
+
+        /**
+         * @brief Estimated exponent k, once two distinct sizes were seen
+        */
+        std::optional<double> get_exponent() const
+        {
+            return m_fit.get_slope();
+        }
+
+        /**
+         * @brief Estimated constant factor a, in cost units
+        */
+        std::optional<double> get_coefficient() const
+        {
+            auto intercept = m_fit.get_intercept();
+            if( !intercept )
+            {
+                return {};
+            }
+            return std::exp( intercept.value() );
+        }
+
+        /**
+         * @brief Standard error of the exponent
+        */
+        std::optional<double> get_exponent_std_error() const
+        {
+            return m_fit.get_slope_std_error();
+        }
+
+        /**
+         * @brief Two-sided confidence interval on the exponent (Student-t, n-2 dof)
+        */
+        std::optional<std::pair<double,double>> get_exponent_confidence_interval( double confidence = 0.95 ) const
+        {
+            auto exponent  = get_exponent();
+            auto std_error = get_exponent_std_error();
+            if( !exponent || !std_error )
+            {
+                return {};
+            }
+            const double t = boost::math::quantile( boost::math::students_t( get_count() - 2 ),
+                                                    0.5 + confidence / 2 );
+            return std::make_pair( exponent.value() - t * std_error.value(),
+                                   exponent.value() + t * std_error.value() );
+        }
+
+        /**
+         * @brief Fraction of log-cost variance explained by the fit
+        */
+        std::optional<double> get_r_squared() const
+        {
+            return m_fit.get_r_squared();
+        }
+
+        /**
+         * @brief Check if the exponent is above the limit with the given confidence
+         * @note  ex:  exceeds_exponent( 1.5 ) flags code that scales clearly worse than n*log(n)
+        */
+        bool exceeds_exponent( double limit,
+                               double confidence = 0.95 ) const
+        {
+            auto interval = get_exponent_confidence_interval( 2 * confidence - 1 );
+            return interval && interval.value().first > limit;
+        }
+
+        /**
+         * @brief Print to log string
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            sin << PRINTER::to_log_string( "Count",
+                                           get_count(),
+                                           "",
+                                           precision );
+
+            auto exponent = get_exponent();
+            if( !exponent )
+            {
+                return sin.str();
+            }
+
+            std::stringstream complexity;
+            complexity << "O(n^" << std::fixed << std::setprecision( 2 ) << exponent.value() << ")";
+            sin << PRINTER::to_log_string( "Complexity",
+                                           complexity.str(),
+                                           "",
+                                           precision );
+            sin << PRINTER::to_log_string( "Exponent",
+                                           exponent.value(),
+                                           "",
+                                           precision );
+            sin << PRINTER::to_log_string( "Coefficient",
+                                           get_coefficient().value(),
+                                           m_units,
+                                           precision );
+
+            auto interval = get_exponent_confidence_interval();
+            if( interval )
+            {
+                sin << PRINTER::to_log_string( "Exponent StdErr",
+                                               get_exponent_std_error().value(),
+                                               "",
+                                               precision );
+                sin << PRINTER::to_log_string( "Exponent 95% Low",
+                                               interval.value().first,
+                                               "",
+                                               precision );
+                sin << PRINTER::to_log_string( "Exponent 95% High",
+                                               interval.value().second,
+                                               "",
+                                               precision );
+            }
+
+            auto r_squared = get_r_squared();
+            if( r_squared )
+            {
+                sin << PRINTER::to_log_string( "R^2",
+                                               r_squared.value(),
+                                               "",
+                                               precision );
+            }
+            return sin.str();
+        }
+
+    private:
+
+        explicit Complexity_Estimator( const std::string& units )
+          : m_fit( Bivariate_Accumulator::create( "log(n)", "log(" + units + ")" ) ),
+            m_units( units )
+        {
+        }
+
+        /// Fit of log(cost) on log(size)
+        Bivariate_Accumulator m_fit;
+
+        /// Unit of measure for the cost
+        std::string m_units;
+
+}; // End of Complexity_Estimator Class
+
+} // End of acc namespace
@@ -0,0 +1,373 @@
+/**
+ * @file    Count_Min_Sketch.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include "Fast_Random.hpp"
+#include "Pretty_Printer.hpp"
+#include "Shell_Printer.hpp"
+
+namespace acc {
+
+/// Default counters per row
+constexpr size_t DEFAULT_SKETCH_WIDTH = 2048;
+
+/// Default number of rows
+constexpr size_t DEFAULT_SKETCH_DEPTH = 4;
+
+/**
+ * @class Count_Min_Sketch
+ *
+ * Fixed-memory point queries over an unbounded key space, ex: "how much total time did
+ * phone number X consume?"  Each row holds width cells of (count, sum), and a key maps to
+ * one cell per row.  An insert touches depth cells, one cache line each.  Queries return the
+ * smallest cell over the rows, which never under-estimates.  Estimates exceed the truth by
+ * more than (e / width) * total with probability at most exp(-depth).
+ *
+ * Inserts use conservative update:  a cell only grows as far as the key's new estimate,
+ * which tightens estimates a lot on skewed streams.  Sums assume non-negative samples, so
+ * negative values add zero to the cell and total sums but still add to the counts.
+ *
+ * Sketches of the same shape merge by adding cells.  Estimates stay upper bounds.
+*/
+template <typename SAMPLE_TP = double>
+class Count_Min_Sketch final
+{
+    public:
+
+        typedef SAMPLE_TP SAMPLE_TYPE;
+
+        /**
+         * @brief Create a sketch
+         * @param units Unit of measure of the samples
+         * @param width Cells per row, rounded up to a power of two
+         * @param depth Number of rows
+        */
+        static Count_Min_Sketch<SAMPLE_TP> create( const std::string& units,
+                                                   size_t             width = DEFAULT_SKETCH_WIDTH,
+                                                   size_t             depth = DEFAULT_SKETCH_DEPTH )
+        {
+            return Count_Min_Sketch<SAMPLE_TP>( units, width, depth );
+        }
+
+        /**
+         * @brief Record a sample for a key.  The key is hashed with std::hash.
+        */
+        template <typename KEY_TP>
+        void insert( const KEY_TP& key,
+                     SAMPLE_TP     new_value )
+        {
+            insert_hash( std::hash<KEY_TP>()( key ), new_value );
+        }
+
+        /**
+         * @brief Record a sample for an already-hashed key
+        */
+        void insert_hash( uint64_t  hash,
+                          SAMPLE_TP new_value )
+        {
+            const double value = std::max( (double)new_value, 0.0 );
+            size_t cells[MAX_DEPTH];
+
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            locate( hash, cells );
+
+            // Current estimates
+            uint64_t count = std::numeric_limits<uint64_t>::max();
+            double   sum   = std::numeric_limits<double>::infinity();
+            for( size_t row = 0; row < m_depth; row++ )
+            {
+                count = std::min( count, m_cells[cells[row]].count );
+                sum   = std::min( sum, m_cells[cells[row]].sum );
+            }
+
+            // Conservative update
+            for( size_t row = 0; row < m_depth; row++ )
+            {
+                auto& cell = m_cells[cells[row]];
+                cell.count = std::max( cell.count, count + 1 );
+                cell.sum   = std::max( cell.sum, sum + value );
+            }
+
+            m_total_count++;
+            m_total_sum += value;
+        }
+
+        /**
+         * @brief Estimated number of samples for a key (never too low)
+        */
+        template <typename KEY_TP>
+        uint64_t get_count( const KEY_TP& key ) const
+        {
+            return query( std::hash<KEY_TP>()( key ) ).count;
+        }
+
+        /**
+         * @brief Estimated sum of samples for a key (never too low)
+        */
+        template <typename KEY_TP>
+        double get_sum( const KEY_TP& key ) const
+        {
+            return query( std::hash<KEY_TP>()( key ) ).sum;
+        }
+
+        /**
+         * @brief Ratio of the sum and count estimates, if the key may have been seen
+        */
+        template <typename KEY_TP>
+        std::optional<double> get_mean( const KEY_TP& key ) const
+        {
+            auto cell = query( std::hash<KEY_TP>()( key ) );
+            if( cell.count == 0 )
+            {
+                return {};
+            }
+            return cell.sum / cell.count;
+        }
+
+        /**
+         * @brief Exact number of samples inserted
+        */
+        uint64_t get_total_count() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_total_count;
+        }
+
+        /**
+         * @brief Exact sum of samples inserted
+        */
+        double get_total_sum() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_total_sum;
+        }
+
+        /**
+         * @brief Count over-estimate that holds with probability 1 - exp(-depth)
+        */
+        double get_count_error_bound() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return std::exp( 1.0 ) / m_width * m_total_count;
+        }
+
+        /**
+         * @brief Cells per row
+        */
+        size_t width() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_width;
+        }
+
+        /**
+         * @brief Number of rows
+        */
+        size_t depth() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_depth;
+        }
+
+        /**
+         * @brief Memory used by the cells, in bytes
+        */
+        size_t memory_footprint() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_cells.size() * sizeof(Cell);
+        }
+
+        /**
+         * @brief Add another sketch's cells to this one
+         * @throws std::invalid_argument if the width or depth differ
+        */
+        void merge( const Count_Min_Sketch<SAMPLE_TP>& other )
+        {
+            if( &other == this )
+            {
+                return;
+            }
+            std::scoped_lock lck( m_acc_mtx, other.m_acc_mtx );
+            if( other.m_width != m_width || other.m_depth != m_depth )
+            {
+                throw std::invalid_argument( "Count_Min_Sketch shapes differ, cannot merge." );
+            }
+            for( size_t i = 0; i < m_cells.size(); i++ )
+            {
+                m_cells[i].count += other.m_cells[i].count;
+                m_cells[i].sum   += other.m_cells[i].sum;
+            }
+            m_total_count += other.m_total_count;
+            m_total_sum   += other.m_total_sum;
+        }
+
+        /**
+         * @brief Write the sketch to an archive
+         * @note  Works with acc::checkpoint::serialize() and Checkpoint_Writer.
+        */
+        template <typename ARCHIVE_TP>
+        void save_state( ARCHIVE_TP& ar ) const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            const uint64_t width = m_width;
+            const uint64_t depth = m_depth;
+            ar << width << depth << m_total_count << m_total_sum << m_units << m_cells;
+        }
+
+        /**
+         * @brief Restore a sketch written by save_state(), including its shape
+         * @param end_offset  Archive offset the state must end at
+         * @note  The sketch is left untouched if the archive is truncated, invalid, or the
+         *        state does not end at end_offset.
+        */
+        template <typename ARCHIVE_TP>
+        void load_state( ARCHIVE_TP& ar,
+                         size_t      end_offset )
+        {
+            uint64_t          width;
+            uint64_t          depth;
+            uint64_t          total_count;
+            double            total_sum;
+            std::string       units;
+            std::vector<Cell> cells;
+            ar >> width >> depth >> total_count >> total_sum >> units >> cells;
+            if( depth == 0 || depth > MAX_DEPTH || !std::has_single_bit( width ) || cells.size() != width * depth )
+            {
+                throw std::runtime_error( "Count_Min_Sketch checkpoint has an invalid shape" );
+            }
+            if( ar.offset() != end_offset )
+            {
+                throw std::runtime_error( "Count_Min_Sketch state size does not match archive" );
+            }
+
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            m_width       = width;
+            m_depth       = depth;
+            m_total_count = total_count;
+            m_total_sum   = total_sum;
+            m_units.swap( units );
+            m_cells.swap( cells );
+        }
+
+        /**
+         * @brief Print to log string
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            sin << PRINTER::to_log_string( "Total Count",
+                                           get_total_count(),
+                                           "",
+                                           precision );
+            sin << PRINTER::to_log_string( "Total Sum",
+                                           get_total_sum(),
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "Sketch Shape",
+                                           std::to_string( depth() ) + "x" + std::to_string( width() ),
+                                           "",
+                                           precision );
+            sin << PRINTER::to_log_string( "Count Error Bound",
+                                           get_count_error_bound(),
+                                           "",
+                                           precision );
+            return sin.str();
+        }
+
+    private:
+
+        /// Upper limit on rows, so row indices fit on the stack
+        static constexpr size_t MAX_DEPTH = 16;
+
+        /**
+         * @struct Cell
+        */
+        struct Cell
+        {
+            uint64_t count { 0 };
+            double   sum { 0 };
+        };
+
+        explicit Count_Min_Sketch( const std::string& units,
+                                   size_t             width,
+                                   size_t             depth )
+          : m_width( std::bit_ceil( std::max<size_t>( width, 1 ) ) ),
+            m_depth( std::clamp<size_t>( depth, 1, MAX_DEPTH ) ),
+            m_cells( m_width * m_depth ),
+            m_units( units )
+        {
+        }
+
+        /**
+         * @brief Cell index of the key in every row (double hashing on a re-mixed key)
+        */
+        void locate( uint64_t hash,
+                     size_t*  cells ) const
+        {
+            uint64_t state = hash;
+            const uint64_t h1 = random::splitmix64( state );
+            const uint64_t h2 = random::splitmix64( state ) | 1;
+            for( size_t row = 0; row < m_depth; row++ )
+            {
+                cells[row] = row * m_width + ( ( h1 + row * h2 ) & ( m_width - 1 ) );
+            }
+        }
+
+        Cell query( uint64_t hash ) const
+        {
+            size_t cells[MAX_DEPTH];
+
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            locate( hash, cells );
+
+            Cell output { std::numeric_limits<uint64_t>::max(), std::numeric_limits<double>::infinity() };
+            for( size_t row = 0; row < m_depth; row++ )
+            {
+                output.count = std::min( output.count, m_cells[cells[row]].count );
+                output.sum   = std::min( output.sum, m_cells[cells[row]].sum );
+            }
+            return output;
+        }
+
+        /// Cells per row (power of two)
+        size_t m_width;
+
+        /// Number of rows
+        size_t m_depth;
+
+        /// Cells, row-major
+        std::vector<Cell> m_cells;
+
+        /// Exact totals
+        uint64_t m_total_count { 0 };
+        double   m_total_sum { 0 };
+
+        /// Unit of measure
+        std::string m_units;
+
+        /// Access Mutex
+        mutable std::mutex m_acc_mtx;
+
+}; // End of Count_Min_Sketch Class
+
+} // End of acc namespace
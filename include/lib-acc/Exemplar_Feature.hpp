@@ -0,0 +1,239 @@
+/**
+ * @file    Exemplar_Feature.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Boost Libraries
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/parameter/keyword.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace acc {
+
+/**
+ * @class Exemplar_Context
+ *
+ * Fixed-size tag saying where a sample came from, ex: a trace ID or request key.  Longer
+ * strings are truncated to MAX_LENGTH bytes, so copying one never allocates.
+*/
+class Exemplar_Context final
+{
+    public:
+
+        static constexpr size_t MAX_LENGTH = 31;
+
+        Exemplar_Context() = default;
+
+        explicit Exemplar_Context( std::string_view text )
+          : m_length( (uint8_t)std::min( text.size(), MAX_LENGTH ) )
+        {
+            std::memcpy( m_data.data(), text.data(), m_length );
+        }
+
+        /**
+         * @brief Numeric ID, stored as 16 hex digits
+        */
+        explicit Exemplar_Context( uint64_t id )
+          : m_length( 16 )
+        {
+            static constexpr char digits[] = "0123456789abcdef";
+            for( int i = 15; i >= 0; i-- )
+            {
+                m_data[i] = digits[id & 0xf];
+                id >>= 4;
+            }
+        }
+
+        std::string_view view() const
+        {
+            return std::string_view( m_data.data(), m_length );
+        }
+
+        std::string str() const
+        {
+            return std::string( view() );
+        }
+
+        bool empty() const
+        {
+            return m_length == 0;
+        }
+
+        bool operator == ( const Exemplar_Context& other ) const
+        {
+            return view() == other.view();
+        }
+
+        /**
+         * @throws std::runtime_error if a loaded length exceeds MAX_LENGTH.  The context is then unchanged.
+        */
+        template <typename ARCHIVE_TP>
+        void serialize( ARCHIVE_TP& ar, const unsigned int version )
+        {
+            uint8_t length = m_length;
+            std::array<char,MAX_LENGTH> data = m_data;
+            ar & length;
+            if( length > MAX_LENGTH )
+            {
+                throw std::runtime_error( "Exemplar_Context checkpoint has an invalid length" );
+            }
+            for( auto& c : data )
+            {
+                ar & c;
+            }
+            m_length = length;
+            m_data   = data;
+        }
+
+    private:
+
+        std::array<char,MAX_LENGTH> m_data {};
+        uint8_t                     m_length { 0 };
+
+}; // End of Exemplar_Context Class
+
+/**
+ * @struct Exemplar
+ *
+ * A retained sample value and the context it was inserted with
+*/
+struct Exemplar
+{
+    double           value { 0 };
+    Exemplar_Context context;
+
+    template <typename ARCHIVE_TP>
+    void serialize( ARCHIVE_TP& ar, const unsigned int version )
+    {
+        ar & value;
+        context.serialize( ar, version );
+    }
+
+}; // End of Exemplar Struct
+
+/// Most exemplars a set can keep
+constexpr size_t MAX_EXEMPLARS = 16;
+
+/// Exemplars kept when no exemplar_count parameter is given
+constexpr size_t DEFAULT_EXEMPLAR_COUNT = 5;
+
+/// Named parameter:  acc::exemplar_count = N, clamped to [1, MAX_EXEMPLARS]
+BOOST_PARAMETER_KEYWORD( tag, exemplar_count )
+
+/// Named per-sample parameter:  acc::exemplar_context = const Exemplar_Context*.  Set by Accumulator::insert( value, context ).
+BOOST_PARAMETER_KEYWORD( tag, exemplar_context )
+
+namespace impl {
+
+/**
+ * @struct exemplars_impl
+ *
+ * The N largest samples which carried a context, largest first.  Once full, a sample costs
+ * one compare against the smallest kept value; only samples beating it are copied in.
+*/
+template <typename SAMPLE_TP>
+struct exemplars_impl : boost::accumulators::accumulator_base
+{
+    typedef std::vector<Exemplar> result_type;
+
+    template <typename ARGS>
+    exemplars_impl( const ARGS& args )
+      : m_capacity( std::clamp<size_t>( args[exemplar_count | DEFAULT_EXEMPLAR_COUNT], 1, MAX_EXEMPLARS ) )
+    {
+    }
+
+    template <typename ARGS>
+    void operator()( const ARGS& args )
+    {
+        const Exemplar_Context* context = args[exemplar_context | (const Exemplar_Context*)nullptr];
+        if( context == nullptr )
+        {
+            return;
+        }
+
+        const double value = (double)args[boost::accumulators::sample];
+        if( m_size == m_capacity && !( value > m_entries[m_size - 1].value ) )
+        {
+            return;
+        }
+
+        // Drop the smallest if full, then slide the new entry into place
+        size_t pos = ( m_size == m_capacity ) ? m_size - 1 : m_size++;
+        while( pos > 0 && m_entries[pos - 1].value < value )
+        {
+            m_entries[pos] = m_entries[pos - 1];
+            pos--;
+        }
+        m_entries[pos].value   = value;
+        m_entries[pos].context = *context;
+    }
+
+    result_type result( boost::accumulators::dont_care ) const
+    {
+        return result_type( m_entries.begin(), m_entries.begin() + m_size );
+    }
+
+    /**
+     * @throws std::runtime_error if the loaded sizes are out of range.  The exemplars are then unchanged.
+    */
+    template <typename ARCHIVE_TP>
+    void serialize( ARCHIVE_TP& ar, const unsigned int version )
+    {
+        size_t capacity = m_capacity;
+        size_t size     = m_size;
+        std::array<Exemplar,MAX_EXEMPLARS> entries = m_entries;
+        ar & capacity;
+        ar & size;
+        if( capacity == 0 || capacity > MAX_EXEMPLARS || size > capacity )
+        {
+            throw std::runtime_error( "Exemplar checkpoint has an invalid size" );
+        }
+        for( size_t i = 0; i < size; i++ )
+        {
+            entries[i].serialize( ar, version );
+        }
+        m_capacity = capacity;
+        m_size     = size;
+        m_entries  = entries;
+    }
+
+    private:
+
+        /// Max exemplars retained
+        size_t m_capacity;
+
+        /// Retained exemplars, largest first
+        std::array<Exemplar,MAX_EXEMPLARS> m_entries {};
+        size_t m_size { 0 };
+
+}; // End of exemplars_impl
+
+} // End of impl namespace
+
+namespace tag {
+
+/**
+ * @struct exemplars
+ * Feature tag for the contexts of the largest samples
+*/
+struct exemplars : boost::accumulators::depends_on<>
+{
+    typedef acc::impl::exemplars_impl<boost::mpl::_1> impl;
+};
+
+} // End of tag namespace
+
+} // End of acc namespace
@@ -0,0 +1,91 @@
+/**
+ * @file    Fast_Random.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace acc::random {
+
+/**
+ * @brief SplitMix64 step.  Used to turn weak seeds into well-mixed generator state.
+*/
+inline uint64_t splitmix64( uint64_t& state )
+{
+    uint64_t z = ( state += 0x9E3779B97F4A7C15ULL );
+    z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBULL;
+    return z ^ ( z >> 31 );
+}
+
+/**
+ * @class Xorshift64
+ *
+ * xorshift64* generator.  A handful of shifts and one multiply per draw; plenty for
+ * sampling decisions, not for anything cryptographic.
+*/
+class Xorshift64
+{
+    public:
+
+        explicit Xorshift64( uint64_t seed = 0x2545F4914F6CDD1DULL )
+        {
+            m_state = splitmix64( seed );
+            if( m_state == 0 )
+            {
+                m_state = 0x2545F4914F6CDD1DULL;
+            }
+        }
+
+        /**
+         * @brief Next raw 64-bit value
+        */
+        uint64_t next()
+        {
+            m_state ^= m_state >> 12;
+            m_state ^= m_state << 25;
+            m_state ^= m_state >> 27;
+            return m_state * 0x2545F4914F6CDD1DULL;
+        }
+
+        /**
+         * @brief Uniform double in the open interval (0,1)
+        */
+        double uniform()
+        {
+            return ( (double)( next() >> 11 ) + 0.5 ) * ( 1.0 / 9007199254740992.0 );
+        }
+
+        /**
+         * @brief Save/restore the generator state
+        */
+        template <typename ARCHIVE_TP>
+        void serialize( ARCHIVE_TP& ar, const unsigned int version )
+        {
+            ar & m_state;
+        }
+
+    private:
+
+        uint64_t m_state;
+
+}; // End of Xorshift64 Class
+
+/**
+ * @brief Per-thread generator, seeded differently for every thread
+*/
+inline Xorshift64& thread_generator()
+{
+    static std::atomic<uint64_t> seed_counter { 0 };
+    thread_local Xorshift64 generator( std::hash<std::thread::id>()( std::this_thread::get_id() ) ^
+                                       ( seed_counter.fetch_add( 1 ) << 32 ) );
+    return generator;
+}
+
+} // End of acc::random namespace
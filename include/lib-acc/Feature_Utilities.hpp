@@ -12,7 +12,10 @@
 #include <boost/mpl/find.hpp>
 
 // C++ Libraries
+#include <cmath>
 #include <functional>
+#include <optional>
+#include <vector>
 
 namespace acc::stats {
 
@@ -81,11 +84,12 @@ struct func_mapper
  * @brief Get the count, if enabled
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if< has_feature<FEATURE_SET,
                                      count_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- count( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ count( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return boost::accumulators::count( acc );
 }
@@ -94,11 +98,12 @@ typename std::enable_if< has_feature<FEATURE_SET,
  * @brief Return a dummy count
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if<!has_feature<FEATURE_SET,
                                      count_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- count( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ count( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return {};
 }
@@ -107,21 +112,23 @@ typename std::enable_if<!has_feature<FEATURE_SET,
  * @brief Get the max, if enabled
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if< has_feature<FEATURE_SET,
                                      max_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- max( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ max( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return boost::accumulators::max( acc );
 }
 
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if<!has_feature<FEATURE_SET,
                                      max_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- max( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ max( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return {};
 }
@@ -130,11 +137,12 @@ typename std::enable_if<!has_feature<FEATURE_SET,
  * @brief Get the mean, if enabled
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if< has_feature<FEATURE_SET,
                                      mean_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- mean( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ mean( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return boost::accumulators::mean( acc );
 }
@@ -143,11 +151,12 @@ typename std::enable_if< has_feature<FEATURE_SET,
  * @brief Return a dummy mean.
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if<!has_feature<FEATURE_SET,
                                      mean_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- mean( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ mean( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return {};
 }
@@ -157,11 +166,12 @@ typename std::enable_if<!has_feature<FEATURE_SET,
  * @brief Get the min, if enabled
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if< has_feature<FEATURE_SET,
                                      min_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- min( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ min( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return boost::accumulators::min( acc );
 }
@@ -170,11 +180,12 @@ typename std::enable_if< has_feature<FEATURE_SET,
  * @brief Get a dummy min
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if<!has_feature<FEATURE_SET,
                                      min_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- min( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ min( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return {};
 }
@@ -183,11 +194,12 @@ typename std::enable_if<!has_feature<FEATURE_SET,
  * @brief Get the rolling mean, if enabled
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if< has_feature<FEATURE_SET,
                                      rolling_mean_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- rolling_mean( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ rolling_mean( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return boost::accumulators::rolling_mean( acc );
 }
@@ -196,11 +208,12 @@ typename std::enable_if< has_feature<FEATURE_SET,
  * @brief Return a dummy rolling mean.
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if<!has_feature<FEATURE_SET,
                                      rolling_mean_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- rolling_mean( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ rolling_mean( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return {};
 }
@@ -209,11 +222,12 @@ typename std::enable_if<!has_feature<FEATURE_SET,
  * @brief Get the rolling sum, if enabled
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if< has_feature<FEATURE_SET,
                                      rolling_sum_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- rolling_sum( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ rolling_sum( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return boost::accumulators::rolling_sum( acc );
 }
@@ -222,11 +236,12 @@ typename std::enable_if< has_feature<FEATURE_SET,
  * @brief Return a dummy rolling sum.
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if<!has_feature<FEATURE_SET,
                                      rolling_sum_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- rolling_sum( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ rolling_sum( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return {};
 }
@@ -235,11 +250,12 @@ typename std::enable_if<!has_feature<FEATURE_SET,
  * @brief Get the rolling variance, if enabled
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if< has_feature<FEATURE_SET,
                                      rolling_variance_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- rolling_variance( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ rolling_variance( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return boost::accumulators::rolling_variance( acc );
 }
@@ -248,11 +264,12 @@ typename std::enable_if< has_feature<FEATURE_SET,
  * @brief Return a dummy rolling variance.
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if<!has_feature<FEATURE_SET,
                                      rolling_variance_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- rolling_variance( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ rolling_variance( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return {};
 }
@@ -261,11 +278,12 @@ typename std::enable_if<!has_feature<FEATURE_SET,
  * @brief Get the variance, if enabled
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if< has_feature<FEATURE_SET,
                                      variance_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- variance( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ variance( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return boost::accumulators::variance( acc );
 }
@@ -274,11 +292,12 @@ typename std::enable_if< has_feature<FEATURE_SET,
  * @brief Get a dummy rolling variance, if disabled.
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if<!has_feature<FEATURE_SET,
                                      variance_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- variance( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ variance( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return {};
 }
@@ -287,24 +306,254 @@ typename std::enable_if<!has_feature<FEATURE_SET,
  * @brief Get the sum, if enabled
 */
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if< has_feature<FEATURE_SET,
                                      sum_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- sum( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ sum( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return boost::accumulators::sum( acc );
 }
 
 template <typename SAMPLE_TP,
-          typename FEATURE_SET>
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
 typename std::enable_if<!has_feature<FEATURE_SET,
                                      sum_stat>::result::value,
                          std::optional<SAMPLE_TP>>::type
- sum( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET>& acc )
+ sum( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
 {
     return {};
 }
 
+/**
+ * @brief Get a copy of the reservoir sample, if enabled
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if< has_feature<FEATURE_SET,
+                                     reservoir_stat>::result::value,
+                         std::optional<std::vector<SAMPLE_TP>>>::type
+ reservoir( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return boost::accumulators::extract_result<reservoir_stat>( acc );
+}
+
+/**
+ * @brief Return a dummy reservoir.
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if<!has_feature<FEATURE_SET,
+                                     reservoir_stat>::result::value,
+                         std::optional<std::vector<SAMPLE_TP>>>::type
+ reservoir( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return {};
+}
+
+/**
+ * @brief Get the retained exemplars, largest first, if enabled
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if< has_feature<FEATURE_SET,
+                                     exemplars_stat>::result::value,
+                         std::optional<std::vector<Exemplar>>>::type
+ exemplars( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return boost::accumulators::extract_result<exemplars_stat>( acc );
+}
+
+/**
+ * @brief Return dummy exemplars.
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if<!has_feature<FEATURE_SET,
+                                     exemplars_stat>::result::value,
+                         std::optional<std::vector<Exemplar>>>::type
+ exemplars( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return {};
+}
+
+/**
+ * @brief Get the CUSUM change-point summary, if enabled
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if< has_feature<FEATURE_SET,
+                                     cusum_stat>::result::value,
+                         std::optional<Change_Point_Summary>>::type
+ cusum( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return boost::accumulators::extract_result<cusum_stat>( acc );
+}
+
+/**
+ * @brief Return a dummy CUSUM change-point summary.
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if<!has_feature<FEATURE_SET,
+                                     cusum_stat>::result::value,
+                         std::optional<Change_Point_Summary>>::type
+ cusum( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return {};
+}
+
+/**
+ * @brief Get the Page-Hinkley change-point summary, if enabled
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if< has_feature<FEATURE_SET,
+                                     page_hinkley_stat>::result::value,
+                         std::optional<Change_Point_Summary>>::type
+ page_hinkley( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return boost::accumulators::extract_result<page_hinkley_stat>( acc );
+}
+
+/**
+ * @brief Return a dummy Page-Hinkley change-point summary.
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if<!has_feature<FEATURE_SET,
+                                     page_hinkley_stat>::result::value,
+                         std::optional<Change_Point_Summary>>::type
+ page_hinkley( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return {};
+}
+
+/**
+ * @brief Get the estimated number of distinct keys, if enabled
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if< has_feature<FEATURE_SET,
+                                     distinct_count_stat>::result::value,
+                         std::optional<double>>::type
+ distinct_count( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return boost::accumulators::extract_result<distinct_count_stat>( acc ).estimate();
+}
+
+/**
+ * @brief Return a dummy distinct count.
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if<!has_feature<FEATURE_SET,
+                                     distinct_count_stat>::result::value,
+                         std::optional<double>>::type
+ distinct_count( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return {};
+}
+
+/**
+ * @brief Get a copy of the distinct-count sketch, if enabled
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if< has_feature<FEATURE_SET,
+                                     distinct_count_stat>::result::value,
+                         std::optional<Hyper_Log_Log>>::type
+ distinct_sketch( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return boost::accumulators::extract_result<distinct_count_stat>( acc );
+}
+
+/**
+ * @brief Return a dummy distinct-count sketch.
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if<!has_feature<FEATURE_SET,
+                                     distinct_count_stat>::result::value,
+                         std::optional<Hyper_Log_Log>>::type
+ distinct_sketch( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return {};
+}
+
+/**
+ * @brief Get the timestamp-derived rates, if enabled
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if< has_feature<FEATURE_SET,
+                                     rate_stat>::result::value,
+                         std::optional<Rate_Summary>>::type
+ rate( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return boost::accumulators::extract_result<rate_stat>( acc );
+}
+
+/**
+ * @brief Return a dummy rate summary.
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if<!has_feature<FEATURE_SET,
+                                     rate_stat>::result::value,
+                         std::optional<Rate_Summary>>::type
+ rate( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return {};
+}
+
+/**
+ * @brief Get the time-weighted mean, if enabled and two timestamps differ
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if< has_feature<FEATURE_SET,
+                                     time_weighted_mean_stat>::result::value,
+                         std::optional<double>>::type
+ time_weighted_mean( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    const double value = boost::accumulators::extract_result<time_weighted_mean_stat>( acc );
+    if( std::isnan( value ) )
+    {
+        return {};
+    }
+    return value;
+}
+
+/**
+ * @brief Return a dummy time-weighted mean.
+*/
+template <typename SAMPLE_TP,
+          typename FEATURE_SET,
+          typename WEIGHT_TP>
+typename std::enable_if<!has_feature<FEATURE_SET,
+                                     time_weighted_mean_stat>::result::value,
+                         std::optional<double>>::type
+ time_weighted_mean( const boost::accumulators::accumulator_set<SAMPLE_TP,FEATURE_SET,WEIGHT_TP>& acc )
+{
+    return {};
+}
 
-} // End of acc::stats namespace
\ No newline at end of file
+} // End of acc::stats namespace
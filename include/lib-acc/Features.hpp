@@ -16,6 +16,16 @@
 #include <boost/accumulators/statistics/rolling_variance.hpp>
 #include <boost/accumulators/statistics/sum.hpp>
 #include <boost/accumulators/statistics/variance.hpp>
+#include <boost/accumulators/statistics/weighted_mean.hpp>
+#include <boost/accumulators/statistics/weighted_sum.hpp>
+#include <boost/accumulators/statistics/weighted_variance.hpp>
+
+// Project Libraries
+#include "Change_Point_Feature.hpp"
+#include "Distinct_Count_Feature.hpp"
+#include "Exemplar_Feature.hpp"
+#include "Rate_Feature.hpp"
+#include "Reservoir_Feature.hpp"
 
 namespace acc {
 
@@ -30,6 +40,15 @@ typedef boost::accumulators::tag::rolling_variance  rolling_variance_stat;
 typedef boost::accumulators::tag::sum               sum_stat;
 typedef boost::accumulators::tag::variance          variance_stat;
 
+/// Aliases for the project-specific features
+typedef acc::tag::cusum                             cusum_stat;
+typedef acc::tag::distinct_count                    distinct_count_stat;
+typedef acc::tag::exemplars                         exemplars_stat;
+typedef acc::tag::page_hinkley                      page_hinkley_stat;
+typedef acc::tag::rate                              rate_stat;
+typedef acc::tag::reservoir                         reservoir_stat;
+typedef acc::tag::time_weighted_mean                time_weighted_mean_stat;
+
 
 
 /// This is a small set of features
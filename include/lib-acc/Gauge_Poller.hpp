@@ -0,0 +1,308 @@
+/**
+ * @file    Gauge_Poller.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include "Accumulator.hpp"
+#include "Periodic_Thread.hpp"
+
+namespace acc {
+
+/// Time-weighted level statistics plus a uniform sample of polled values
+typedef boost::accumulators::stats<mean_stat,
+                                   min_stat,
+                                   max_stat,
+                                   count_stat,
+                                   variance_stat,
+                                   reservoir_stat> GAUGE_FEATURE_SET;
+
+/**
+ * @class Gauge
+ *
+ * One polled level, ex: a queue depth.  Each value is weighted by how long it was held,
+ * in seconds, so the mean is a time-weighted average even when polls are late.  The
+ * reservoir keeps polled values for quantiles.
+*/
+class Gauge final
+{
+    public:
+
+        typedef Accumulator<GAUGE_FEATURE_SET,double,double> ACCUMULATOR_TP;
+        typedef std::function<double()>                      CALLBACK_TP;
+        typedef std::chrono::steady_clock                    CLOCK_TP;
+
+        Gauge( const std::string& name,
+               const std::string& units,
+               CALLBACK_TP        callback,
+               size_t             reservoir_capacity = DEFAULT_RESERVOIR_SIZE )
+          : m_name( name ),
+            m_units( units ),
+            m_callback( std::move( callback ) ),
+            m_accumulator( ACCUMULATOR_TP::create_with_params( units, acc::reservoir_size = reservoir_capacity ) )
+        {
+        }
+
+        Gauge( const Gauge& ) = delete;
+        Gauge& operator = ( const Gauge& ) = delete;
+
+        /**
+         * @brief Read the level now.  The previous reading is recorded, weighted by how
+         *        long it held.
+        */
+        void poll( CLOCK_TP::time_point now = CLOCK_TP::now() )
+        {
+            const double value = m_callback();
+            std::unique_lock<std::mutex> lck( m_mtx );
+            hold_until( now );
+            m_last_value = value;
+            m_last_time  = now;
+        }
+
+        /**
+         * @brief Record the latest reading up to now, without polling again
+        */
+        void flush( CLOCK_TP::time_point now = CLOCK_TP::now() )
+        {
+            std::unique_lock<std::mutex> lck( m_mtx );
+            hold_until( now );
+            m_last_time = now;
+        }
+
+        const std::string& name() const
+        {
+            return m_name;
+        }
+
+        /**
+         * @brief Most recent polled value
+        */
+        std::optional<double> last_value() const
+        {
+            std::unique_lock<std::mutex> lck( m_mtx );
+            return m_last_value;
+        }
+
+        /**
+         * @brief Time-weighted statistics.  Weights are seconds held.
+        */
+        const ACCUMULATOR_TP& get_accumulator() const
+        {
+            return m_accumulator;
+        }
+
+        /**
+         * @brief Time-weighted average level
+        */
+        std::optional<double> get_time_weighted_mean() const
+        {
+            if( m_accumulator.number_items_inserted() == 0 )
+            {
+                return {};
+            }
+            return m_accumulator.get_mean();
+        }
+
+        /**
+         * @brief Quantile of the polled values, from the reservoir
+         * @param q  In [0,1]
+        */
+        std::optional<double> get_quantile( double q ) const
+        {
+            auto samples = m_accumulator.get_reservoir();
+            if( !samples || samples.value().empty() )
+            {
+                return {};
+            }
+            auto& values = samples.value();
+            const size_t index = std::min<size_t>( (size_t)std::llround( std::clamp( q, 0.0, 1.0 ) * ( values.size() - 1 ) ),
+                                                   values.size() - 1 );
+            std::nth_element( values.begin(), values.begin() + index, values.end() );
+            return values[index];
+        }
+
+        /**
+         * @brief Print to log string
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            auto mean = get_time_weighted_mean();
+            if( !mean )
+            {
+                return sin.str();
+            }
+            const auto& units = m_units;
+            sin << PRINTER::to_log_string( m_name + " TWA", mean.value(), units, precision );
+            sin << PRINTER::to_log_string( m_name + " Min", m_accumulator.get_min().value(), units, precision );
+            sin << PRINTER::to_log_string( m_name + " P50", get_quantile( 0.5 ).value(), units, precision );
+            sin << PRINTER::to_log_string( m_name + " P99", get_quantile( 0.99 ).value(), units, precision );
+            sin << PRINTER::to_log_string( m_name + " Max", m_accumulator.get_max().value(), units, precision );
+            return sin.str();
+        }
+
+    private:
+
+        void hold_until( CLOCK_TP::time_point now )
+        {
+            if( !m_last_value || now <= m_last_time )
+            {
+                return;
+            }
+            const double held = std::chrono::duration<double>( now - m_last_time ).count();
+            m_accumulator.insert( m_last_value.value(), held );
+        }
+
+        /// Gauge name, used as the report prefix
+        std::string m_name;
+
+        /// Unit of measure
+        std::string m_units;
+
+        /// Reads the level
+        CALLBACK_TP m_callback;
+
+        /// Latest reading, not yet recorded
+        std::optional<double> m_last_value;
+        CLOCK_TP::time_point  m_last_time;
+        mutable std::mutex    m_mtx;
+
+        ACCUMULATOR_TP m_accumulator;
+
+}; // End of Gauge Class
+
+/**
+ * @class Gauge_Poller
+ *
+ * One Periodic_Thread polling every registered Gauge each period.  Polls stay on the
+ * thread's absolute grid, so a slow callback does not push later polls back; ticks that
+ * are already past when it wakes are skipped and counted.
+*/
+class Gauge_Poller final
+{
+    public:
+
+        typedef Gauge::CLOCK_TP CLOCK_TP;
+
+        explicit Gauge_Poller( std::chrono::microseconds period = std::chrono::milliseconds( 100 ) )
+          : m_poller( period, [this](){ poll(); } )
+        {
+        }
+
+        Gauge_Poller( const Gauge_Poller& ) = delete;
+        Gauge_Poller& operator = ( const Gauge_Poller& ) = delete;
+
+        ~Gauge_Poller()
+        {
+            stop();
+        }
+
+        /**
+         * @brief Register a gauge.  The callback runs on the poller thread.
+         * @return Reference valid for the life of the poller
+        */
+        Gauge& add_gauge( const std::string&  name,
+                          const std::string&  units,
+                          Gauge::CALLBACK_TP  callback,
+                          size_t              reservoir_capacity = DEFAULT_RESERVOIR_SIZE )
+        {
+            std::unique_lock<std::mutex> lck( m_gauge_mtx );
+            m_gauges.push_back( std::make_unique<Gauge>( name, units, std::move( callback ), reservoir_capacity ) );
+            return *m_gauges.back();
+        }
+
+        /**
+         * @brief Start the poller thread
+        */
+        void start()
+        {
+            m_poller.start();
+        }
+
+        /**
+         * @brief Stop the poller thread and record every gauge's last reading up to now
+        */
+        void stop()
+        {
+            if( !m_poller.stop() )
+            {
+                return;
+            }
+
+            const auto now = CLOCK_TP::now();
+            std::unique_lock<std::mutex> lck( m_gauge_mtx );
+            for( auto& gauge : m_gauges )
+            {
+                gauge->flush( now );
+            }
+        }
+
+        /**
+         * @brief Poll every gauge now, on the calling thread
+        */
+        void poll()
+        {
+            const auto now = CLOCK_TP::now();
+            std::unique_lock<std::mutex> lck( m_gauge_mtx );
+            for( auto& gauge : m_gauges )
+            {
+                gauge->poll( now );
+            }
+        }
+
+        /**
+         * @brief Ticks skipped because the previous pass overran
+        */
+        int64_t missed_ticks() const
+        {
+            return m_poller.missed_ticks();
+        }
+
+        std::chrono::microseconds period() const
+        {
+            return m_poller.period();
+        }
+
+        /**
+         * @brief Print every gauge
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            std::unique_lock<std::mutex> lck( m_gauge_mtx );
+            for( const auto& gauge : m_gauges )
+            {
+                sin << gauge->toLogString<PRINTER>( precision );
+            }
+            return sin.str();
+        }
+
+    private:
+
+        /// Registered gauges
+        std::vector<std::unique_ptr<Gauge>> m_gauges;
+        mutable std::mutex m_gauge_mtx;
+
+        /// Poller thread, declared last so it stops before the gauges go
+        Periodic_Thread m_poller;
+
+}; // End of Gauge_Poller Class
+
+} // End of acc namespace
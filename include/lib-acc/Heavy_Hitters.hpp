@@ -0,0 +1,320 @@
+/**
+ * @file    Heavy_Hitters.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Project Libraries
+#include "Pretty_Printer.hpp"
+#include "Shell_Printer.hpp"
+#include "Summary_Stats.hpp"
+
+namespace acc {
+
+/**
+ * @enum Heavy_Hitter_Rank
+*/
+enum class Heavy_Hitter_Rank : int
+{
+    COUNT = 0 /*< Keys with the most samples*/,
+    TOTAL = 1 /*< Keys with the largest sum of samples, ex: total time*/,
+};
+
+/**
+ * @struct Heavy_Hitter
+ *
+ * One tracked key.  The rank is an over-estimate by at most error, so rank - error is a
+ * guaranteed lower bound.  Stats cover the samples seen since the key last entered the table.
+*/
+template <typename KEY_TP>
+struct Heavy_Hitter
+{
+    /// Key being tracked
+    KEY_TP key;
+
+    /// Estimated count or total
+    double rank { 0 };
+
+    /// Maximum over-estimation of the rank
+    double error { 0 };
+
+    /// Samples recorded for this key
+    Summary_Stats stats;
+
+}; // End of Heavy_Hitter Struct
+
+/**
+ * @class Heavy_Hitters
+ *
+ * Bounded-memory top-K tracker using the Space-Saving algorithm (Metwally et al.).  At most
+ * capacity keys are tracked.  A new key replaces the key with the smallest rank and
+ * inherits that rank as its error.  The evicted key's stats are merged into the "other"
+ * bucket, so the tracked keys plus "other" always add up to the whole stream.  Any key
+ * whose true share is above 1/capacity of the total is guaranteed to be tracked.
+ *
+ * Tracked keys sit in a min-heap indexed by a hash map.  Inserts are O(1) on average for
+ * count ranking, and O(log capacity) in the worst case.
+*/
+template <typename KEY_TP,
+          typename SAMPLE_TP = double,
+          typename HASH_TP = std::hash<KEY_TP>>
+class Heavy_Hitters final
+{
+    public:
+
+        /**
+         * @brief Create a heavy-hitters tracker
+         * @param capacity Maximum number of keys with their own stats
+         * @param units    Unit of measure of the samples
+         * @param rank     Whether keys compete on count or on total
+        */
+        static Heavy_Hitters<KEY_TP,SAMPLE_TP,HASH_TP> create( size_t             capacity,
+                                                               const std::string& units,
+                                                               Heavy_Hitter_Rank  rank = Heavy_Hitter_Rank::COUNT )
+        {
+            return Heavy_Hitters<KEY_TP,SAMPLE_TP,HASH_TP>( capacity, units, rank );
+        }
+
+        /**
+         * @brief Record a sample for a key
+        */
+        void insert( const KEY_TP& key,
+                     SAMPLE_TP     new_value )
+        {
+            const double value  = (double)new_value;
+            const double weight = ( m_rank == Heavy_Hitter_Rank::COUNT ) ? 1.0 : std::max( value, 0.0 );
+
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            m_total.insert( value );
+
+            auto it = m_index.find( key );
+            if( it != m_index.end() )
+            {
+                auto& entry = m_heap[it->second];
+                entry.rank += weight;
+                entry.stats.insert( value );
+                sift_down( it->second );
+                return;
+            }
+
+            if( m_heap.size() < m_capacity )
+            {
+                Heavy_Hitter<KEY_TP> entry;
+                entry.key  = key;
+                entry.rank = weight;
+                entry.stats.insert( value );
+                m_heap.push_back( std::move( entry ) );
+                m_index[key] = m_heap.size() - 1;
+                sift_up( m_heap.size() - 1 );
+                return;
+            }
+
+            // Replace the smallest key
+            auto& victim = m_heap.front();
+            m_other.merge( victim.stats );
+            m_index.erase( victim.key );
+
+            victim.key   = key;
+            victim.error = victim.rank;
+            victim.rank += weight;
+            victim.stats = Summary_Stats();
+            victim.stats.insert( value );
+            m_index[key] = 0;
+            sift_down( 0 );
+        }
+
+        /**
+         * @brief Get the tracked keys, largest rank first
+         * @param max_entries Maximum number of keys to return
+        */
+        std::vector<Heavy_Hitter<KEY_TP>> get_top( size_t max_entries = std::numeric_limits<size_t>::max() ) const
+        {
+            std::vector<Heavy_Hitter<KEY_TP>> output;
+            {
+                std::unique_lock<std::mutex> lck(m_acc_mtx);
+                output = m_heap;
+            }
+            std::sort( output.begin(),
+                       output.end(),
+                       []( const auto& lhs, const auto& rhs ){ return lhs.rank > rhs.rank; } );
+            if( output.size() > max_entries )
+            {
+                output.resize( max_entries );
+            }
+            return output;
+        }
+
+        /**
+         * @brief Get the stats of samples from keys that were evicted
+        */
+        Summary_Stats get_other() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_other;
+        }
+
+        /**
+         * @brief Get the stats over all samples
+        */
+        Summary_Stats get_total() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_total;
+        }
+
+        /**
+         * @brief Get the number of keys currently tracked
+        */
+        size_t size() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_heap.size();
+        }
+
+        /**
+         * @brief Print to log string
+         * @param max_entries Number of keys to print
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( size_t max_entries = 10,
+                                 int    precision = 6 ) const
+        {
+            std::stringstream sin;
+            for( const auto& entry : get_top( max_entries ) )
+            {
+                std::stringstream key;
+                key << entry.key;
+                print_stats<PRINTER>( sin, key.str(), entry.stats, precision );
+            }
+            print_stats<PRINTER>( sin, "Other", get_other(), precision );
+            return sin.str();
+        }
+
+    private:
+
+        explicit Heavy_Hitters( size_t             capacity,
+                                const std::string& units,
+                                Heavy_Hitter_Rank  rank )
+          : m_capacity( std::max<size_t>( capacity, 1 ) ),
+            m_rank( rank ),
+            m_units( units )
+        {
+            m_heap.reserve( m_capacity );
+            m_index.reserve( m_capacity );
+        }
+
+        template <typename PRINTER>
+        void print_stats( std::stringstream&   sin,
+                          const std::string&   name,
+                          const Summary_Stats& stats,
+                          int                  precision ) const
+        {
+            sin << PRINTER::to_log_string( name + " Count",
+                                           stats.count,
+                                           "",
+                                           precision );
+            if( stats.count == 0 )
+            {
+                return;
+            }
+            sin << PRINTER::to_log_string( name + " Mean",
+                                           stats.mean().value(),
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( name + " Max",
+                                           stats.max,
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( name + " Sum",
+                                           stats.sum,
+                                           m_units,
+                                           precision );
+        }
+
+        void swap_entries( size_t lhs,
+                           size_t rhs )
+        {
+            std::swap( m_heap[lhs], m_heap[rhs] );
+            m_index[m_heap[lhs].key] = lhs;
+            m_index[m_heap[rhs].key] = rhs;
+        }
+
+        void sift_up( size_t pos )
+        {
+            while( pos > 0 )
+            {
+                size_t parent = ( pos - 1 ) / 2;
+                if( !( m_heap[pos].rank < m_heap[parent].rank ) )
+                {
+                    return;
+                }
+                swap_entries( pos, parent );
+                pos = parent;
+            }
+        }
+
+        void sift_down( size_t pos )
+        {
+            while( true )
+            {
+                size_t smallest = pos;
+                size_t left     = 2 * pos + 1;
+                size_t right    = left + 1;
+                if( left < m_heap.size() && m_heap[left].rank < m_heap[smallest].rank )
+                {
+                    smallest = left;
+                }
+                if( right < m_heap.size() && m_heap[right].rank < m_heap[smallest].rank )
+                {
+                    smallest = right;
+                }
+                if( smallest == pos )
+                {
+                    return;
+                }
+                swap_entries( pos, smallest );
+                pos = smallest;
+            }
+        }
+
+        /// Maximum number of tracked keys
+        size_t m_capacity;
+
+        /// What keys compete on
+        Heavy_Hitter_Rank m_rank;
+
+        /// Tracked keys, min-heap on rank
+        std::vector<Heavy_Hitter<KEY_TP>> m_heap;
+
+        /// Key to heap position
+        std::unordered_map<KEY_TP,size_t,HASH_TP> m_index;
+
+        /// Samples of evicted keys
+        Summary_Stats m_other;
+
+        /// All samples
+        Summary_Stats m_total;
+
+        /// Unit of measure
+        std::string m_units;
+
+        /// Access Mutex
+        mutable std::mutex m_acc_mtx;
+
+}; // End of Heavy_Hitters Class
+
+} // End of acc namespace
@@ -0,0 +1,226 @@
+/**
+ * @file    Instrumented_Mutex.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+
+// Project Libraries
+#include "Pretty_Printer.hpp"
+#include "Print_Utilities.hpp"
+#include "Timing_Accumulator.hpp"
+
+namespace acc {
+
+/**
+ * @class Instrumented_Mutex
+ *
+ * Lockable wrapper around MUTEX_TP that records how long callers wait to acquire it, how
+ * long it is held, and how often an acquisition is contended.  Drop-in for std::mutex with
+ * std::unique_lock / std::scoped_lock, and with std::condition_variable_any.
+ *
+ * The uncontended path is one try_lock plus a counter bump.  Only a failed try_lock reads
+ * the clock, so the wait accumulator sees every contended acquisition.  Hold time is
+ * measured on one acquisition out of every hold_sample_period (1 measures all of them).
+ *
+ * @note  Counters and the hold timer are only written by the thread holding the lock.
+*/
+template <typename MUTEX_TP = std::mutex,
+          typename DISPLAY_DURATION = std::chrono::duration<double,std::micro>>
+class Instrumented_Mutex final
+{
+    public:
+
+        typedef Timing_Accumulator<DISPLAY_DURATION> TIMING_TP;
+
+        explicit Instrumented_Mutex( uint32_t hold_sample_period = 16 )
+          : m_hold_sample_period( std::max<uint32_t>( hold_sample_period, 1 ) ),
+            m_hold_countdown( m_hold_sample_period ),
+            m_wait( TIMING_TP::create() ),
+            m_hold( TIMING_TP::create() )
+        {
+        }
+
+        Instrumented_Mutex( const Instrumented_Mutex& ) = delete;
+        Instrumented_Mutex& operator = ( const Instrumented_Mutex& ) = delete;
+
+        /**
+         * @brief Acquire the lock, timing the wait if it is already held
+        */
+        void lock()
+        {
+            if( m_mutex.try_lock() )
+            {
+                on_acquired();
+                return;
+            }
+
+            const auto wait_start = std::chrono::steady_clock::now();
+            m_mutex.lock();
+            const auto acquired = std::chrono::steady_clock::now();
+
+            bump( m_contended );
+            m_wait.insert( acquired - wait_start );
+            on_acquired();
+        }
+
+        /**
+         * @brief Acquire the lock if it is free.  A failed attempt is not recorded.
+        */
+        bool try_lock()
+        {
+            if( !m_mutex.try_lock() )
+            {
+                return false;
+            }
+            on_acquired();
+            return true;
+        }
+
+        /**
+         * @brief Release the lock.  A sampled hold is recorded after the release.
+        */
+        void unlock()
+        {
+            if( !m_hold_timed )
+            {
+                m_mutex.unlock();
+                return;
+            }
+
+            m_hold_timed = false;
+            const auto held = std::chrono::steady_clock::now() - m_hold_start;
+            m_mutex.unlock();
+            m_hold.insert( held );
+        }
+
+        /**
+         * @brief Number of successful acquisitions
+        */
+        int64_t get_acquisitions() const
+        {
+            return m_acquisitions.load( std::memory_order_relaxed );
+        }
+
+        /**
+         * @brief Number of acquisitions that had to block
+        */
+        int64_t get_contended() const
+        {
+            return m_contended.load( std::memory_order_relaxed );
+        }
+
+        /**
+         * @brief Fraction of acquisitions that had to block, once anything was acquired
+        */
+        std::optional<double> get_contention_rate() const
+        {
+            auto acquisitions = get_acquisitions();
+            if( acquisitions == 0 )
+            {
+                return {};
+            }
+            return (double)get_contended() / acquisitions;
+        }
+
+        /**
+         * @brief Time spent blocked in lock(), one entry per contended acquisition
+        */
+        const TIMING_TP& get_wait() const
+        {
+            return m_wait;
+        }
+
+        /**
+         * @brief Time between acquire and release, for the sampled acquisitions
+        */
+        const TIMING_TP& get_hold() const
+        {
+            return m_hold;
+        }
+
+        uint32_t get_hold_sample_period() const
+        {
+            return m_hold_sample_period;
+        }
+
+        /**
+         * @brief Print to log string
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            if( get_acquisitions() == 0 )
+            {
+                return sin.str();
+            }
+            sin << PRINTER::to_log_string( "Acquisitions",
+                                           get_acquisitions(),
+                                           "",
+                                           precision );
+            sin << PRINTER::to_log_string( "Contended",
+                                           get_contended(),
+                                           "",
+                                           precision );
+            sin << PRINTER::to_log_string( "Contention Rate",
+                                           get_contention_rate().value(),
+                                           "",
+                                           precision );
+            const auto units = duration_units<typename DISPLAY_DURATION::period>();
+            acc::print::print_summary<PRINTER>( sin, "Wait", m_wait, units, precision, acc::print::SUMMARY_ALL );
+            acc::print::print_summary<PRINTER>( sin, "Hold", m_hold, units, precision, acc::print::SUMMARY_ALL );
+            return sin.str();
+        }
+
+    private:
+
+        /**
+         * @brief Bump a counter.  Only the lock holder writes, so no read-modify-write is needed.
+        */
+        static void bump( std::atomic<int64_t>& counter )
+        {
+            counter.store( counter.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        }
+
+        void on_acquired()
+        {
+            bump( m_acquisitions );
+            if( --m_hold_countdown == 0 )
+            {
+                m_hold_countdown = m_hold_sample_period;
+                m_hold_timed     = true;
+                m_hold_start     = std::chrono::steady_clock::now();
+            }
+        }
+
+        /// Wrapped Mutex
+        MUTEX_TP m_mutex;
+
+        /// Acquisition Counters
+        std::atomic<int64_t> m_acquisitions { 0 };
+        std::atomic<int64_t> m_contended { 0 };
+
+        /// Hold Sampling (only touched while locked)
+        uint32_t m_hold_sample_period;
+        uint32_t m_hold_countdown;
+        bool     m_hold_timed { false };
+        std::chrono::steady_clock::time_point m_hold_start;
+
+        /// Wait and Hold Times
+        TIMING_TP m_wait;
+        TIMING_TP m_hold;
+
+}; // End of Instrumented_Mutex Class
+
+} // End of acc namespace
@@ -0,0 +1,440 @@
+/**
+ * @file    Perf_Counters.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// POSIX Libraries
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+// Project Libraries
+#include "Accumulator.hpp"
+#include "Print_Utilities.hpp"
+#include "Stopwatch.hpp"
+
+namespace acc::perf {
+
+/**
+ * @enum Perf_Event
+*/
+enum class Perf_Event : int
+{
+    CYCLES           = 0 /*< CPU cycles (hardware)*/,
+    INSTRUCTIONS     = 1 /*< Retired instructions (hardware)*/,
+    LLC_MISSES       = 2 /*< Last-level cache misses (hardware)*/,
+    TASK_CLOCK       = 3 /*< CPU time of the thread, ns (software)*/,
+    CONTEXT_SWITCHES = 4 /*< Times the thread was switched out (software)*/,
+    PAGE_FAULTS      = 5 /*< Page faults (software)*/,
+};
+
+/// Number of Perf_Event values
+constexpr size_t PERF_EVENT_COUNT = 6;
+
+/**
+ * @brief Printable name of an event
+*/
+inline std::string to_string( Perf_Event event )
+{
+    switch( event )
+    {
+        case Perf_Event::CYCLES:           return "Cycles";
+        case Perf_Event::INSTRUCTIONS:     return "Instructions";
+        case Perf_Event::LLC_MISSES:       return "LLC Misses";
+        case Perf_Event::TASK_CLOCK:       return "Task Clock";
+        case Perf_Event::CONTEXT_SWITCHES: return "Context Switches";
+        case Perf_Event::PAGE_FAULTS:      return "Page Faults";
+    }
+    return "Unknown";
+}
+
+/**
+ * @brief Unit label of an event
+*/
+inline std::string units( Perf_Event event )
+{
+    switch( event )
+    {
+        case Perf_Event::CYCLES:           return "cycles";
+        case Perf_Event::INSTRUCTIONS:     return "instructions";
+        case Perf_Event::LLC_MISSES:       return "misses";
+        case Perf_Event::TASK_CLOCK:       return "ns";
+        case Perf_Event::CONTEXT_SWITCHES: return "switches";
+        case Perf_Event::PAGE_FAULTS:      return "faults";
+    }
+    return "";
+}
+
+/**
+ * @struct Perf_Reading
+ *
+ * Counter values at one point in time.  Events that could not be opened stay unavailable.
+*/
+struct Perf_Reading
+{
+    /// Counter values, scaled up if the kernel multiplexed the counter
+    std::array<uint64_t,PERF_EVENT_COUNT> values {};
+
+    /// Which entries of values are valid
+    std::array<bool,PERF_EVENT_COUNT> available {};
+
+    uint64_t value( Perf_Event event ) const
+    {
+        return values[(int)event];
+    }
+
+    bool has( Perf_Event event ) const
+    {
+        return available[(int)event];
+    }
+
+}; // End of Perf_Reading Struct
+
+/**
+ * @class Perf_Counter_Group
+ *
+ * perf_event_open counters for the calling thread, user space only, so it works with the
+ * default perf_event_paranoid setting.  Events the kernel refuses are skipped.  This
+ * happens for hardware events in most containers and VMs, and for every event where
+ * perf_event_open is blocked or on non-Linux builds.  The software events then still
+ * show whether a region was descheduled or faulting.
+ *
+ * Counters follow the thread that opened them.  Use thread_group() for a per-thread instance.
+*/
+class Perf_Counter_Group
+{
+    public:
+
+        Perf_Counter_Group()
+        {
+            m_fds.fill( -1 );
+            for( size_t i = 0; i < PERF_EVENT_COUNT; i++ )
+            {
+                m_fds[i] = open_event( (Perf_Event)i );
+            }
+        }
+
+        ~Perf_Counter_Group()
+        {
+            for( auto fd : m_fds )
+            {
+                if( fd >= 0 )
+                {
+                    close( fd );
+                }
+            }
+        }
+
+        Perf_Counter_Group( const Perf_Counter_Group& ) = delete;
+        Perf_Counter_Group& operator = ( const Perf_Counter_Group& ) = delete;
+
+        /**
+         * @brief Group for the calling thread, opened on first use
+        */
+        static Perf_Counter_Group& thread_group()
+        {
+            thread_local Perf_Counter_Group group;
+            return group;
+        }
+
+        /**
+         * @brief Check if an event could be opened
+        */
+        bool is_available( Perf_Event event ) const
+        {
+            return m_fds[(int)event] >= 0;
+        }
+
+        /**
+         * @brief Check if any hardware PMU event could be opened
+        */
+        bool has_hardware() const
+        {
+            return is_available( Perf_Event::CYCLES ) ||
+                   is_available( Perf_Event::INSTRUCTIONS ) ||
+                   is_available( Perf_Event::LLC_MISSES );
+        }
+
+        /**
+         * @brief Read all open counters
+        */
+        Perf_Reading read() const
+        {
+            Perf_Reading output;
+            for( size_t i = 0; i < PERF_EVENT_COUNT; i++ )
+            {
+                if( m_fds[i] < 0 )
+                {
+                    continue;
+                }
+                // value, time enabled, time running
+                uint64_t data[3] {};
+                if( ::read( m_fds[i], data, sizeof(data) ) != (ssize_t)sizeof(data) )
+                {
+                    continue;
+                }
+                output.values[i]    = ( data[2] > 0 && data[2] < data[1] ) ? (uint64_t)( (double)data[0] * data[1] / data[2] ) : data[0];
+                output.available[i] = true;
+            }
+            return output;
+        }
+
+    private:
+
+        static int open_event( Perf_Event event )
+        {
+#if defined(__linux__)
+            perf_event_attr attr;
+            std::memset( &attr, 0, sizeof(attr) );
+            attr.size           = sizeof(attr);
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            switch( event )
+            {
+                case Perf_Event::CYCLES:
+                    attr.type   = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                    break;
+                case Perf_Event::INSTRUCTIONS:
+                    attr.type   = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                    break;
+                case Perf_Event::LLC_MISSES:
+                    attr.type   = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+                    break;
+                case Perf_Event::TASK_CLOCK:
+                    attr.type   = PERF_TYPE_SOFTWARE;
+                    attr.config = PERF_COUNT_SW_TASK_CLOCK;
+                    break;
+                case Perf_Event::CONTEXT_SWITCHES:
+                    attr.type   = PERF_TYPE_SOFTWARE;
+                    attr.config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+                    break;
+                case Perf_Event::PAGE_FAULTS:
+                    attr.type   = PERF_TYPE_SOFTWARE;
+                    attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+                    break;
+            }
+            return (int)syscall( SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC );
+#else
+            return -1;
+#endif
+        }
+
+        /// One descriptor per event, -1 if unavailable
+        std::array<int,PERF_EVENT_COUNT> m_fds;
+
+}; // End of Perf_Counter_Group Class
+
+/**
+ * @class Perf_Region
+ *
+ * Statistics for one code region:  wall time, one Accumulator per counter delta, plus
+ * instructions per cycle and LLC misses per thousand instructions when the hardware
+ * counters are there.  Fed by Perf_Scope, safe to share across threads.
+*/
+template <typename FEATURE_SET = FULL_FEATURE_SET>
+class Perf_Region final
+{
+    public:
+
+        typedef Accumulator<FEATURE_SET,double> ACCUMULATOR_TP;
+
+        static Perf_Region<FEATURE_SET> create( const std::string& name )
+        {
+            return Perf_Region<FEATURE_SET>( name );
+        }
+
+        /**
+         * @brief Add one pass through the region
+        */
+        void record( const Perf_Reading&          begin,
+                     const Perf_Reading&          end,
+                     std::chrono::nanoseconds     wall_time )
+        {
+            m_wall_time.insert( wall_time.count() / 1e6 );
+            for( size_t i = 0; i < PERF_EVENT_COUNT; i++ )
+            {
+                if( auto change = delta( begin, end, (Perf_Event)i ) )
+                {
+                    m_events[i]->insert( change.value() );
+                }
+            }
+
+            const auto cycles       = delta( begin, end, Perf_Event::CYCLES );
+            const auto instructions = delta( begin, end, Perf_Event::INSTRUCTIONS );
+            const auto llc_misses   = delta( begin, end, Perf_Event::LLC_MISSES );
+            if( instructions && cycles && cycles.value() > 0 )
+            {
+                m_ipc.insert( instructions.value() / cycles.value() );
+            }
+            if( llc_misses && instructions && instructions.value() > 0 )
+            {
+                m_llc_mpki.insert( 1000 * llc_misses.value() / instructions.value() );
+            }
+        }
+
+        const std::string& name() const
+        {
+            return m_name;
+        }
+
+        /**
+         * @brief Wall time per pass, in ms
+        */
+        const ACCUMULATOR_TP& get_wall_time() const
+        {
+            return m_wall_time;
+        }
+
+        /**
+         * @brief Counter delta per pass
+        */
+        const ACCUMULATOR_TP& get_event( Perf_Event event ) const
+        {
+            return *m_events[(int)event];
+        }
+
+        /**
+         * @brief Instructions per cycle, per pass
+        */
+        const ACCUMULATOR_TP& get_ipc() const
+        {
+            return m_ipc;
+        }
+
+        /**
+         * @brief LLC misses per 1000 instructions, per pass
+        */
+        const ACCUMULATOR_TP& get_llc_miss_rate() const
+        {
+            return m_llc_mpki;
+        }
+
+        /**
+         * @brief Print the mean of every populated statistic
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            acc::print::print_summary<PRINTER>( sin, m_name + " Wall Time", m_wall_time, "ms", precision, acc::print::SUMMARY_MEAN );
+            for( size_t i = 0; i < PERF_EVENT_COUNT; i++ )
+            {
+                acc::print::print_summary<PRINTER>( sin, m_name + " " + to_string( (Perf_Event)i ), *m_events[i],
+                                                    units( (Perf_Event)i ), precision, acc::print::SUMMARY_MEAN );
+            }
+            acc::print::print_summary<PRINTER>( sin, m_name + " IPC", m_ipc, "", precision, acc::print::SUMMARY_MEAN );
+            acc::print::print_summary<PRINTER>( sin, m_name + " LLC MPKI", m_llc_mpki, "", precision, acc::print::SUMMARY_MEAN );
+            return sin.str();
+        }
+
+    private:
+
+        explicit Perf_Region( const std::string& name )
+          : m_name( name ),
+            m_wall_time( ACCUMULATOR_TP::create( "ms" ) ),
+            m_ipc( ACCUMULATOR_TP::create( "" ) ),
+            m_llc_mpki( ACCUMULATOR_TP::create( "" ) )
+        {
+            for( size_t i = 0; i < PERF_EVENT_COUNT; i++ )
+            {
+                m_events[i].reset( new ACCUMULATOR_TP( ACCUMULATOR_TP::create( units( (Perf_Event)i ) ) ) );
+            }
+        }
+
+        /**
+         * @brief Change of a counter over one pass, if both readings have it
+         *
+         * Multiplexed counters are scaled estimates and can read lower at the end of a short
+         * pass than at the start.  The difference is taken signed and such passes are dropped,
+         * rather than wrapping to a huge unsigned delta.
+        */
+        static std::optional<double> delta( const Perf_Reading& begin,
+                                            const Perf_Reading& end,
+                                            Perf_Event          event )
+        {
+            if( !begin.has( event ) || !end.has( event ) )
+            {
+                return {};
+            }
+            const int64_t change = (int64_t)( end.value( event ) - begin.value( event ) );
+            if( change < 0 )
+            {
+                return {};
+            }
+            return (double)change;
+        }
+
+        /// Region name, used as the report prefix
+        std::string m_name;
+
+        /// Wall time per pass
+        ACCUMULATOR_TP m_wall_time;
+
+        /// Counter deltas, by Perf_Event
+        std::array<std::unique_ptr<ACCUMULATOR_TP>,PERF_EVENT_COUNT> m_events;
+
+        /// Derived ratios
+        ACCUMULATOR_TP m_ipc;
+        ACCUMULATOR_TP m_llc_mpki;
+
+}; // End of Perf_Region Class
+
+/**
+ * @class Perf_Scope
+ *
+ * Reads the calling thread's counters on construction and records the deltas into a
+ * Perf_Region on destruction, ex:
+ *
+ *   { acc::perf::Perf_Scope scope( region );  do_work(); }
+*/
+template <typename FEATURE_SET = FULL_FEATURE_SET>
+class Perf_Scope final
+{
+    public:
+
+        explicit Perf_Scope( Perf_Region<FEATURE_SET>& region )
+          : m_region( region ),
+            m_begin( Perf_Counter_Group::thread_group().read() )
+        {
+        }
+
+        ~Perf_Scope()
+        {
+            auto wall_time = m_stopwatch.template stop<std::chrono::nanoseconds>();
+            m_region.record( m_begin, Perf_Counter_Group::thread_group().read(), wall_time );
+        }
+
+        Perf_Scope( const Perf_Scope& ) = delete;
+        Perf_Scope& operator = ( const Perf_Scope& ) = delete;
+
+    private:
+
+        Perf_Region<FEATURE_SET>& m_region;
+
+        Perf_Reading m_begin;
+
+        Stopwatch<> m_stopwatch;
+
+}; // End of Perf_Scope Class
+
+} // End of acc::perf namespace
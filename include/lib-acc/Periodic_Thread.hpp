@@ -0,0 +1,156 @@
+/**
+ * @file    Periodic_Thread.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace acc {
+
+/**
+ * @class Periodic_Thread
+ *
+ * Background thread calling one function every period, shared by the samplers, pollers and
+ * watchdogs.  Ticks are scheduled on an absolute grid (start + n * period), so a slow call
+ * does not push later ticks back; ticks already past when the thread wakes are skipped and
+ * counted.  stop() wakes the thread instead of waiting out the period.
+ *
+ * Owners should call stop() in their destructor, before the state the callback uses goes.
+*/
+class Periodic_Thread final
+{
+    public:
+
+        typedef std::chrono::steady_clock CLOCK_TP;
+        typedef std::function<void()>     CALLBACK_TP;
+
+        /**
+         * @param period         Time between ticks, at least 1 us
+         * @param callback       Called on the thread each tick
+         * @param tick_on_start  Tick as soon as the thread starts, rather than one period later
+        */
+        Periodic_Thread( std::chrono::microseconds period,
+                         CALLBACK_TP               callback,
+                         bool                      tick_on_start = true )
+          : m_period( std::max( period, std::chrono::microseconds( 1 ) ) ),
+            m_callback( std::move( callback ) ),
+            m_tick_on_start( tick_on_start )
+        {
+        }
+
+        Periodic_Thread( const Periodic_Thread& ) = delete;
+        Periodic_Thread& operator = ( const Periodic_Thread& ) = delete;
+
+        ~Periodic_Thread()
+        {
+            stop();
+        }
+
+        /**
+         * @brief Start the thread.  Does nothing if it is already running.
+        */
+        void start()
+        {
+            if( m_running.exchange( true ) )
+            {
+                return;
+            }
+            m_thread = std::thread( [this](){ run(); } );
+        }
+
+        /**
+         * @brief Stop the thread, waiting for a tick in progress
+         * @return True if a running thread was stopped
+        */
+        bool stop()
+        {
+            {
+                std::unique_lock<std::mutex> lck( m_wait_mtx );
+                m_running = false;
+            }
+            m_wake.notify_all();
+            if( !m_thread.joinable() )
+            {
+                return false;
+            }
+            m_thread.join();
+            return true;
+        }
+
+        bool is_running() const
+        {
+            return m_running.load();
+        }
+
+        std::chrono::microseconds period() const
+        {
+            return m_period;
+        }
+
+        /**
+         * @brief Ticks skipped because the previous call overran
+        */
+        int64_t missed_ticks() const
+        {
+            return m_missed_ticks.load( std::memory_order_relaxed );
+        }
+
+    private:
+
+        /**
+         * @brief Thread loop
+        */
+        void run()
+        {
+            auto next = CLOCK_TP::now();
+            if( !m_tick_on_start )
+            {
+                next += m_period;
+            }
+
+            std::unique_lock<std::mutex> lck( m_wait_mtx );
+            while( !m_wake.wait_until( lck, next, [this](){ return !m_running; } ) )
+            {
+                lck.unlock();
+                m_callback();
+                lck.lock();
+
+                // Next grid point still ahead of us
+                next += m_period;
+                const auto now = CLOCK_TP::now();
+                if( next <= now )
+                {
+                    const auto behind = ( now - next ) / m_period + 1;
+                    m_missed_ticks.fetch_add( behind, std::memory_order_relaxed );
+                    next += behind * m_period;
+                }
+            }
+        }
+
+        /// Time between ticks
+        std::chrono::microseconds m_period;
+
+        CALLBACK_TP m_callback;
+        bool        m_tick_on_start;
+
+        std::atomic<int64_t> m_missed_ticks { 0 };
+
+        std::atomic<bool>       m_running { false };
+        std::mutex              m_wait_mtx;
+        std::condition_variable m_wake;
+        std::thread             m_thread;
+
+}; // End of Periodic_Thread Class
+
+} // End of acc namespace
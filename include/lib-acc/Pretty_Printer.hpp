@@ -33,7 +33,7 @@ struct Printer
              << std::setprecision( precision );
 
         sout << key;
-        for( int i=0; i < (max_key_len - key.size()); i++ )
+        for( int i=0; i < (max_key_len - (int)key.size()); i++ )
         {
             if( (i+key.size()) % 2 == 0 ){
                 sout << ".";
@@ -0,0 +1,114 @@
+/**
+ * @file    Print_Utilities.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace acc::print {
+
+/**
+ * @brief Statistics print_summary() writes, OR'd together
+*/
+enum Summary_Fields : unsigned
+{
+    SUMMARY_MEAN = 1,
+    SUMMARY_MAX  = 2,
+    SUMMARY_SUM  = 4,
+    SUMMARY_ALL  = SUMMARY_MEAN | SUMMARY_MAX | SUMMARY_SUM,
+}; // End of Summary_Fields Enum
+
+/**
+ * @brief Print one statistic.  Empty optionals are skipped, durations print their count.
+*/
+template <typename PRINTER,
+          typename VALUE_TP>
+void print_statistic( std::stringstream& sin,
+                      const std::string& key,
+                      const VALUE_TP&    value,
+                      const std::string& units,
+                      int                precision )
+{
+    if constexpr ( requires { value.has_value(); } )
+    {
+        if( value.has_value() )
+        {
+            print_statistic<PRINTER>( sin, key, value.value(), units, precision );
+        }
+    }
+    else if constexpr ( requires { value.count(); } )
+    {
+        sin << PRINTER::to_log_string( key, value.count(), units, precision );
+    }
+    else
+    {
+        sin << PRINTER::to_log_string( key, value, units, precision );
+    }
+}
+
+/**
+ * @brief Print "<key> Mean", "<key> Max" and/or "<key> Sum" of an Accumulator or
+ *        Timing_Accumulator, or nothing if it is empty
+*/
+template <typename PRINTER,
+          typename ACCUMULATOR_TP>
+void print_summary( std::stringstream&    sin,
+                    const std::string&    key,
+                    const ACCUMULATOR_TP& acc,
+                    const std::string&    units,
+                    int                   precision,
+                    unsigned              fields = SUMMARY_MEAN | SUMMARY_MAX )
+{
+    int64_t count;
+    if constexpr ( requires { acc.number_items_inserted(); } )
+    {
+        count = acc.number_items_inserted();
+    }
+    else
+    {
+        count = acc.get_count();
+    }
+    if( count == 0 )
+    {
+        return;
+    }
+
+    if( fields & SUMMARY_MEAN )
+    {
+        print_statistic<PRINTER>( sin, key + " Mean", acc.get_mean(), units, precision );
+    }
+    if( fields & SUMMARY_MAX )
+    {
+        print_statistic<PRINTER>( sin, key + " Max", acc.get_max(), units, precision );
+    }
+    if( fields & SUMMARY_SUM )
+    {
+        print_statistic<PRINTER>( sin, key + " Sum", acc.get_sum(), units, precision );
+    }
+}
+
+/**
+ * @brief Printer adapter which prefixes every key with PREFIX_TP::prefix, so a nested
+ *        accumulator's fields can be told apart from the enclosing report's
+*/
+template <typename PRINTER,
+          typename PREFIX_TP>
+struct Prefixed_Printer
+{
+    template <typename SAMPLE_TYPE>
+    static std::string to_log_string( const std::string& key,
+                                      const SAMPLE_TYPE& value,
+                                      const std::string& units,
+                                      int                precision )
+    {
+        return PRINTER::to_log_string( std::string( PREFIX_TP::prefix ) + " " + key, value, units, precision );
+    }
+
+}; // End of Prefixed_Printer Struct
+
+} // End of acc::print namespace
@@ -0,0 +1,279 @@
+/**
+ * @file    Rate_Feature.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Boost Libraries
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/parameter/keyword.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace acc {
+
+/// Time constant of the windowed rates, in seconds, when no rate_window parameter is given
+constexpr double DEFAULT_RATE_WINDOW = 1.0;
+
+/// Named parameter:  acc::rate_window = seconds
+BOOST_PARAMETER_KEYWORD( tag, rate_window )
+
+/// Named per-sample parameter:  acc::sample_time = seconds.  Set by Accumulator::insert( value, time_point ).
+BOOST_PARAMETER_KEYWORD( tag, sample_time )
+
+/**
+ * @struct Rate_Summary
+ *
+ * Throughput derived from sample timestamps.  "Event" rates count samples per second;
+ * "value" rates sum the sample values per second, ex: bytes/s when the samples are sizes.
+ * Samples inserted without a timestamp are not counted.
+*/
+struct Rate_Summary
+{
+    /// Timestamped samples seen
+    int64_t count { 0 };
+
+    /// Seconds between the first and last timestamp
+    double span { 0 };
+
+    /// Over the whole span.  The first sample opens the span, so it is not counted.
+    double event_rate { 0 };
+    double value_rate { 0 };
+
+    /// From the last two timestamps
+    double instant_event_rate { 0 };
+    double instant_value_rate { 0 };
+
+    /// Exponentially weighted over rate_window seconds, as of the last sample
+    double windowed_event_rate { 0 };
+    double windowed_value_rate { 0 };
+
+}; // End of Rate_Summary Struct
+
+namespace impl {
+
+/**
+ * @struct rate_impl
+ *
+ * O(1) per sample.  Each interval between timestamps yields an instantaneous rate, 1 / dt
+ * (or value / dt), and the windowed rates are its exponential moving average:
+ *
+ *   rate = rate * exp(-dt / window) + ( 1 - exp(-dt / window) ) * instant
+ *
+ * Weighting each interval by its length keeps the average unbiased for any dt, even when
+ * samples are as sparse as the window.  The first interval seeds it.  Samples which share
+ * a timestamp with the previous one, or go back in time, are counted in the next interval.
+*/
+template <typename SAMPLE_TP>
+struct rate_impl : boost::accumulators::accumulator_base
+{
+    typedef Rate_Summary result_type;
+
+    template <typename ARGS>
+    rate_impl( const ARGS& args )
+      : m_window( args[rate_window | DEFAULT_RATE_WINDOW] > 0 ? args[rate_window | DEFAULT_RATE_WINDOW] : DEFAULT_RATE_WINDOW )
+    {
+    }
+
+    template <typename ARGS>
+    void operator()( const ARGS& args )
+    {
+        const double time = args[sample_time | std::numeric_limits<double>::quiet_NaN()];
+        if( std::isnan( time ) )
+        {
+            return;
+        }
+        const double value = (double)args[boost::accumulators::sample];
+
+        m_count++;
+        if( m_count == 1 )
+        {
+            m_first_time = time;
+            m_last_time  = time;
+            return;
+        }
+        m_value_total += value;
+
+        const double dt = time - m_last_time;
+        if( !( dt > 0 ) )
+        {
+            m_pending_events++;
+            m_pending_values += value;
+            return;
+        }
+
+        m_instant_events = ( m_pending_events + 1 ) / dt;
+        m_instant_values = ( m_pending_values + value ) / dt;
+        m_pending_events = 0;
+        m_pending_values = 0;
+        m_last_time      = time;
+
+        if( !m_seeded )
+        {
+            m_seeded          = true;
+            m_windowed_events = m_instant_events;
+            m_windowed_values = m_instant_values;
+            return;
+        }
+        const double decay = std::exp( -dt / m_window );
+        m_windowed_events = m_windowed_events * decay + ( 1 - decay ) * m_instant_events;
+        m_windowed_values = m_windowed_values * decay + ( 1 - decay ) * m_instant_values;
+    }
+
+    result_type result( boost::accumulators::dont_care ) const
+    {
+        Rate_Summary output;
+        output.count = m_count;
+        output.span  = m_last_time - m_first_time;
+        if( output.span > 0 )
+        {
+            output.event_rate = ( m_count - 1 ) / output.span;
+            output.value_rate = m_value_total / output.span;
+        }
+        output.instant_event_rate  = m_instant_events;
+        output.instant_value_rate  = m_instant_values;
+        output.windowed_event_rate = m_windowed_events;
+        output.windowed_value_rate = m_windowed_values;
+        return output;
+    }
+
+    template <typename ARCHIVE_TP>
+    void serialize( ARCHIVE_TP& ar, const unsigned int version )
+    {
+        ar & m_window;
+        ar & m_count;
+        ar & m_first_time;
+        ar & m_last_time;
+        ar & m_value_total;
+        ar & m_instant_events;
+        ar & m_instant_values;
+        ar & m_windowed_events;
+        ar & m_windowed_values;
+        ar & m_seeded;
+        ar & m_pending_events;
+        ar & m_pending_values;
+    }
+
+    private:
+
+        /// Windowed-rate time constant, in seconds
+        double m_window;
+
+        int64_t m_count { 0 };
+        double  m_first_time { 0 };
+        double  m_last_time { 0 };
+
+        /// Sum of values after the first sample
+        double m_value_total { 0 };
+
+        double m_instant_events { 0 };
+        double m_instant_values { 0 };
+        double m_windowed_events { 0 };
+        double m_windowed_values { 0 };
+
+        /// Whether an interval has set the windowed rates yet
+        bool m_seeded { false };
+
+        /// Samples waiting for the clock to advance
+        int64_t m_pending_events { 0 };
+        double  m_pending_values { 0 };
+
+}; // End of rate_impl
+
+/**
+ * @struct time_weighted_mean_impl
+ *
+ * Mean of a level where each sample holds until the next one:
+ * sum( v_i * ( t_i+1 - t_i ) ) / ( t_last - t_first ).  NaN until two timestamps differ.
+*/
+template <typename SAMPLE_TP>
+struct time_weighted_mean_impl : boost::accumulators::accumulator_base
+{
+    typedef double result_type;
+
+    template <typename ARGS>
+    time_weighted_mean_impl( const ARGS& args )
+    {
+    }
+
+    template <typename ARGS>
+    void operator()( const ARGS& args )
+    {
+        const double time = args[sample_time | std::numeric_limits<double>::quiet_NaN()];
+        if( std::isnan( time ) )
+        {
+            return;
+        }
+
+        if( m_started && time > m_last_time )
+        {
+            m_area     += m_last_value * ( time - m_last_time );
+            m_duration += time - m_last_time;
+            m_last_time = time;
+        }
+        else if( !m_started )
+        {
+            m_started   = true;
+            m_last_time = time;
+        }
+        m_last_value = (double)args[boost::accumulators::sample];
+    }
+
+    result_type result( boost::accumulators::dont_care ) const
+    {
+        return ( m_duration > 0 ) ? m_area / m_duration : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    template <typename ARCHIVE_TP>
+    void serialize( ARCHIVE_TP& ar, const unsigned int version )
+    {
+        ar & m_started;
+        ar & m_last_time;
+        ar & m_last_value;
+        ar & m_area;
+        ar & m_duration;
+    }
+
+    private:
+
+        bool   m_started { false };
+        double m_last_time { 0 };
+        double m_last_value { 0 };
+
+        /// Integral of the level and the time it covers
+        double m_area { 0 };
+        double m_duration { 0 };
+
+}; // End of time_weighted_mean_impl
+
+} // End of impl namespace
+
+namespace tag {
+
+/**
+ * @struct rate
+ * Feature tag for timestamp-derived throughput
+*/
+struct rate : boost::accumulators::depends_on<>
+{
+    typedef acc::impl::rate_impl<boost::mpl::_1> impl;
+};
+
+/**
+ * @struct time_weighted_mean
+ * Feature tag for the time-weighted mean of a level
+*/
+struct time_weighted_mean : boost::accumulators::depends_on<>
+{
+    typedef acc::impl::time_weighted_mean_impl<boost::mpl::_1> impl;
+};
+
+} // End of tag namespace
+
+} // End of acc namespace
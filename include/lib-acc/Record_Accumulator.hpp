@@ -0,0 +1,507 @@
+/**
+ * @file    Record_Accumulator.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Boost Libraries
+#include <boost/mpl/contains.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/mpl/remove_if.hpp>
+#include <boost/mpl/vector.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Project Libraries
+#include "Feature_Utilities.hpp"
+#include "Pretty_Printer.hpp"
+#include "Shell_Printer.hpp"
+
+namespace acc {
+
+/// Window size used by rolling features when a field does not give one
+constexpr size_t DEFAULT_RECORD_WINDOW_SIZE = 100;
+
+/**
+ * @struct Field_Name
+ *
+ * String literal usable as a template argument, ex:  Record_Field<"Bytes">.
+*/
+template <size_t N>
+struct Field_Name
+{
+    constexpr Field_Name( const char (&text)[N] )
+    {
+        std::copy_n( text, N, value );
+    }
+
+    constexpr std::string_view view() const
+    {
+        return std::string_view( value, N - 1 );
+    }
+
+    char value[N] {};
+
+}; // End of Field_Name Struct
+
+/// Features a Record_Accumulator keeps in its shared struct-of-arrays columns
+typedef boost::mpl::vector<count_stat,
+                           mean_stat,
+                           min_stat,
+                           max_stat,
+                           sum_stat,
+                           variance_stat> RECORD_CORE_FEATURES;
+
+/**
+ * @struct No_Extra_Features
+ *
+ * Stand-in for a field whose features are all core features
+*/
+struct No_Extra_Features {};
+
+/**
+ * @struct Record_Field
+ *
+ * Describes one metric of a record:  its name, feature set and sample type.  Core features
+ * (count, mean, min, max, sum, variance) live in the record's columns; anything else, ex:
+ * rolling_mean, gets a Boost accumulator set of its own.
+*/
+template <Field_Name NAME,
+          typename FEATURE_SET = FULL_FEATURE_SET,
+          typename SAMPLE_TP = double>
+struct Record_Field
+{
+    typedef FEATURE_SET FEATURE_SET_TP;
+    typedef SAMPLE_TP   SAMPLE_TYPE;
+
+    static constexpr std::string_view name()
+    {
+        return NAME.view();
+    }
+
+    /// Features not covered by the columns
+    typedef typename boost::mpl::remove_if<FEATURE_SET,
+                                           boost::mpl::contains<RECORD_CORE_FEATURES,boost::mpl::_1>>::type EXTRA_FEATURES_TP;
+
+    static constexpr bool HAS_EXTRAS = !boost::mpl::empty<EXTRA_FEATURES_TP>::value;
+
+    /// Boost set for the extra features, if there are any
+    typedef std::conditional_t<HAS_EXTRAS,
+                               boost::accumulators::accumulator_set<SAMPLE_TP,EXTRA_FEATURES_TP>,
+                               No_Extra_Features> EXTRA_SET_TP;
+
+    template <typename FEATURE_TP>
+    static constexpr bool has() { return acc::stats::has_feature<FEATURE_SET,FEATURE_TP>::result::value; }
+
+}; // End of Record_Field Struct
+
+/**
+ * @struct Record_Field_Info
+ *
+ * Runtime settings of a field
+*/
+struct Record_Field_Info
+{
+    /// Unit of measure
+    std::string units;
+
+    /// Window size for rolling features (ignored otherwise)
+    size_t window_size { DEFAULT_RECORD_WINDOW_SIZE };
+
+}; // End of Record_Field_Info Struct
+
+/**
+ * @class Record_Accumulator
+ *
+ * Accumulates events that carry several metrics at once, ex: (duration, bytes, ratio).
+ * The core statistics are stored struct-of-arrays:  one column per statistic with a slot
+ * per field, so an event updates a few adjacent doubles per statistic under a single lock.
+ * Every record carries every field, so they share one count.  Reports are taken under the
+ * same lock and are a consistent snapshot across fields.
+ *
+ * Fields are addressed by name or position, ex:  get_mean<"Bytes">() or get_mean<1>().
+ *
+ * @note  Columns hold doubles, so integer sums are exact only up to 2^53.
+*/
+template <typename... FIELD_TPS>
+class Record_Accumulator final
+{
+    public:
+
+        /// Number of fields per record
+        static constexpr size_t FIELD_COUNT = sizeof...(FIELD_TPS);
+
+        /// Field type at a given position
+        template <size_t INDEX>
+        using field_tp = std::tuple_element_t<INDEX,std::tuple<FIELD_TPS...>>;
+
+        /// One Record_Field_Info per field, to expand the create() parameters
+        template <typename FIELD_TP>
+        using field_info_tp = Record_Field_Info;
+
+        /**
+         * @brief Position of a field, resolved at compile time
+        */
+        template <Field_Name NAME>
+        static constexpr size_t index_of()
+        {
+            constexpr std::array<std::string_view,FIELD_COUNT> names { FIELD_TPS::name()... };
+            constexpr size_t index = std::find( names.begin(), names.end(), NAME.view() ) - names.begin();
+            static_assert( index < FIELD_COUNT, "No field with this name in the record" );
+            return index;
+        }
+
+        /**
+         * @brief Create a record accumulator
+         * @param fields Units (and rolling window) of each field, in template order
+        */
+        static Record_Accumulator<FIELD_TPS...> create( const field_info_tp<FIELD_TPS>&... fields )
+        {
+            return Record_Accumulator<FIELD_TPS...>( fields... );
+        }
+
+        /**
+         * @brief Add one record.  All fields are updated under a single lock.
+        */
+        void insert( const typename FIELD_TPS::SAMPLE_TYPE&... values )
+        {
+            const std::array<double,FIELD_COUNT> x { (double)values... };
+
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            m_insert_counter++;
+            const double n = (double)m_insert_counter;
+
+            // Welford update, one column at a time
+            for( size_t i = 0; i < FIELD_COUNT; i++ )
+            {
+                const double delta = x[i] - m_mean[i];
+                m_mean[i] += delta / n;
+                m_m2[i]   += delta * ( x[i] - m_mean[i] );
+            }
+            for( size_t i = 0; i < FIELD_COUNT; i++ )
+            {
+                m_sum[i] += x[i];
+                m_min[i]  = std::min( m_min[i], x[i] );
+                m_max[i]  = std::max( m_max[i], x[i] );
+            }
+
+            insert_extras( std::index_sequence_for<FIELD_TPS...>{}, values... );
+        }
+
+        /**
+         * @brief Get the number of records inserted
+        */
+        int64_t number_items_inserted() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_insert_counter;
+        }
+
+        /**
+         * @brief Get the name of a field
+        */
+        template <size_t INDEX>
+        static constexpr std::string_view get_field_name()
+        {
+            return field_tp<INDEX>::name();
+        }
+
+        /**
+         * @brief Get the count of a field, if enabled
+        */
+        template <size_t INDEX>
+        std::optional<int64_t> get_count() const
+        {
+            if constexpr ( !field_tp<INDEX>::template has<count_stat>() )
+            {
+                return {};
+            }
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_insert_counter;
+        }
+
+        template <Field_Name NAME>
+        std::optional<int64_t> get_count() const
+        {
+            return get_count<index_of<NAME>()>();
+        }
+
+        /**
+         * @brief Get the mean of a field, if enabled
+        */
+        template <size_t INDEX>
+        std::optional<double> get_mean() const
+        {
+            return column<INDEX,mean_stat>( m_mean );
+        }
+
+        template <Field_Name NAME>
+        std::optional<double> get_mean() const
+        {
+            return get_mean<index_of<NAME>()>();
+        }
+
+        /**
+         * @brief Get the min of a field, if enabled
+        */
+        template <size_t INDEX>
+        std::optional<typename field_tp<INDEX>::SAMPLE_TYPE> get_min() const
+        {
+            return column<INDEX,min_stat>( m_min );
+        }
+
+        template <Field_Name NAME>
+        auto get_min() const
+        {
+            return get_min<index_of<NAME>()>();
+        }
+
+        /**
+         * @brief Get the max of a field, if enabled
+        */
+        template <size_t INDEX>
+        std::optional<typename field_tp<INDEX>::SAMPLE_TYPE> get_max() const
+        {
+            return column<INDEX,max_stat>( m_max );
+        }
+
+        template <Field_Name NAME>
+        auto get_max() const
+        {
+            return get_max<index_of<NAME>()>();
+        }
+
+        /**
+         * @brief Get the population variance of a field, if enabled
+        */
+        template <size_t INDEX>
+        std::optional<double> get_variance() const
+        {
+            if constexpr ( !field_tp<INDEX>::template has<variance_stat>() )
+            {
+                return {};
+            }
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_insert_counter == 0 )
+            {
+                return {};
+            }
+            return m_m2[INDEX] / m_insert_counter;
+        }
+
+        template <Field_Name NAME>
+        std::optional<double> get_variance() const
+        {
+            return get_variance<index_of<NAME>()>();
+        }
+
+        /**
+         * @brief Get the sum of a field, if enabled
+        */
+        template <size_t INDEX>
+        std::optional<typename field_tp<INDEX>::SAMPLE_TYPE> get_sum() const
+        {
+            return column<INDEX,sum_stat>( m_sum );
+        }
+
+        template <Field_Name NAME>
+        auto get_sum() const
+        {
+            return get_sum<index_of<NAME>()>();
+        }
+
+        /**
+         * @brief Get the rolling mean of a field, if enabled
+        */
+        template <size_t INDEX>
+        std::optional<typename field_tp<INDEX>::SAMPLE_TYPE> get_rolling_mean() const
+        {
+            if constexpr ( !field_tp<INDEX>::HAS_EXTRAS )
+            {
+                return {};
+            }
+            else
+            {
+                std::unique_lock<std::mutex> lck(m_acc_mtx);
+                return acc::stats::rolling_mean( std::get<INDEX>( m_extras ) );
+            }
+        }
+
+        template <Field_Name NAME>
+        auto get_rolling_mean() const
+        {
+            return get_rolling_mean<index_of<NAME>()>();
+        }
+
+        /**
+         * @brief Print all fields to one log string
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+
+            sin << PRINTER::to_log_string( "Records",
+                                           m_insert_counter,
+                                           "",
+                                           precision );
+            if( m_insert_counter <= 0 )
+            {
+                return sin.str();
+            }
+
+            print_fields<PRINTER>( sin, precision, std::index_sequence_for<FIELD_TPS...>{} );
+            return sin.str();
+        }
+
+    private:
+
+        explicit Record_Accumulator( const field_info_tp<FIELD_TPS>&... fields )
+          : m_field_info{ fields... },
+            m_extras( make_extras<FIELD_TPS>( fields )... )
+        {
+            m_min.fill( std::numeric_limits<double>::infinity() );
+            m_max.fill( -std::numeric_limits<double>::infinity() );
+        }
+
+        template <typename FIELD_TP>
+        static typename FIELD_TP::EXTRA_SET_TP make_extras( const Record_Field_Info& info )
+        {
+            if constexpr ( FIELD_TP::HAS_EXTRAS )
+            {
+                return typename FIELD_TP::EXTRA_SET_TP( boost::accumulators::tag::rolling_window::window_size = info.window_size );
+            }
+            else
+            {
+                return {};
+            }
+        }
+
+        /**
+         * @brief Read one slot of a column, if the field has the feature
+        */
+        template <size_t INDEX,
+                  typename FEATURE_TP>
+        std::optional<std::conditional_t<std::is_same_v<FEATURE_TP,mean_stat>,double,typename field_tp<INDEX>::SAMPLE_TYPE>>
+            column( const std::array<double,FIELD_COUNT>& values ) const
+        {
+            if constexpr ( !field_tp<INDEX>::template has<FEATURE_TP>() )
+            {
+                return {};
+            }
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_insert_counter == 0 )
+            {
+                return {};
+            }
+            return values[INDEX];
+        }
+
+        /**
+         * @brief Feed each value to its field's extra features.  Caller holds the lock.
+        */
+        template <size_t... INDICES>
+        void insert_extras( std::index_sequence<INDICES...>,
+                            const typename FIELD_TPS::SAMPLE_TYPE&... values )
+        {
+            ( insert_extra<INDICES>( values ), ... );
+        }
+
+        template <size_t INDEX>
+        void insert_extra( const typename field_tp<INDEX>::SAMPLE_TYPE& value )
+        {
+            if constexpr ( field_tp<INDEX>::HAS_EXTRAS )
+            {
+                std::get<INDEX>( m_extras )( value );
+            }
+        }
+
+        template <typename PRINTER,
+                  size_t... INDICES>
+        void print_fields( std::stringstream&  sin,
+                           int                 precision,
+                           std::index_sequence<INDICES...> ) const
+        {
+            ( print_field<PRINTER,INDICES>( sin, precision ), ... );
+        }
+
+        /**
+         * @brief Print the enabled features of one field.  Caller holds the lock.
+        */
+        template <typename PRINTER,
+                  size_t INDEX>
+        void print_field( std::stringstream& sin,
+                          int                precision ) const
+        {
+            typedef field_tp<INDEX> FIELD_TP;
+            typedef typename FIELD_TP::SAMPLE_TYPE SAMPLE_TP;
+            const std::string name( FIELD_TP::name() );
+            const auto& units = m_field_info[INDEX].units;
+
+            if constexpr ( FIELD_TP::template has<mean_stat>() )
+            {
+                sin << PRINTER::to_log_string( name + " Mean", m_mean[INDEX], units, precision );
+            }
+            if constexpr ( FIELD_TP::HAS_EXTRAS )
+            {
+                if( auto value = acc::stats::rolling_mean( std::get<INDEX>( m_extras ) ) )
+                {
+                    sin << PRINTER::to_log_string( name + " Rolling Mean", value.value(), units, precision );
+                }
+            }
+            if constexpr ( FIELD_TP::template has<min_stat>() )
+            {
+                sin << PRINTER::to_log_string( name + " Min", (SAMPLE_TP)m_min[INDEX], units, precision );
+            }
+            if constexpr ( FIELD_TP::template has<max_stat>() )
+            {
+                sin << PRINTER::to_log_string( name + " Max", (SAMPLE_TP)m_max[INDEX], units, precision );
+            }
+            if constexpr ( FIELD_TP::template has<variance_stat>() )
+            {
+                sin << PRINTER::to_log_string( name + " StdDev", std::sqrt( m_m2[INDEX] / m_insert_counter ), units, precision );
+            }
+            if constexpr ( FIELD_TP::template has<sum_stat>() )
+            {
+                sin << PRINTER::to_log_string( name + " Sum", (SAMPLE_TP)m_sum[INDEX], units, precision );
+            }
+        }
+
+        /// Number of records inserted, shared by every field
+        int64_t m_insert_counter { 0 };
+
+        /// Core statistic columns, one slot per field
+        std::array<double,FIELD_COUNT> m_mean {};
+        std::array<double,FIELD_COUNT> m_m2 {};
+        std::array<double,FIELD_COUNT> m_sum {};
+        std::array<double,FIELD_COUNT> m_min;
+        std::array<double,FIELD_COUNT> m_max;
+
+        /// Units and windows, in field order
+        std::array<Record_Field_Info,FIELD_COUNT> m_field_info;
+
+        /// Boost sets for features outside the columns
+        std::tuple<typename FIELD_TPS::EXTRA_SET_TP...> m_extras;
+
+        /// Access Mutex (one for all fields)
+        mutable std::mutex m_acc_mtx;
+
+}; // End of Record_Accumulator Class
+
+} // End of acc namespace
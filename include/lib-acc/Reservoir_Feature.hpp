@@ -0,0 +1,162 @@
+/**
+ * @file    Reservoir_Feature.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Boost Libraries
+#include <boost/accumulators/framework/accumulator_base.hpp>
+#include <boost/accumulators/framework/depends_on.hpp>
+#include <boost/accumulators/framework/parameters/sample.hpp>
+#include <boost/parameter/keyword.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+// Project Libraries
+#include "Fast_Random.hpp"
+
+namespace acc {
+
+/// Number of raw samples kept when no reservoir_size parameter is given
+constexpr size_t DEFAULT_RESERVOIR_SIZE = 1024;
+
+/// Named parameter:  acc::reservoir_size = K
+BOOST_PARAMETER_KEYWORD( tag, reservoir_size )
+
+namespace impl {
+
+/**
+ * @struct reservoir_impl
+ *
+ * Uniform sample of K raw values using Vitter's Algorithm L.  Once the reservoir is full,
+ * the number of samples to skip is drawn directly, so most inserts are a single compare.
+*/
+template <typename SAMPLE_TP>
+struct reservoir_impl : boost::accumulators::accumulator_base
+{
+    typedef std::vector<SAMPLE_TP> result_type;
+
+    template <typename ARGS>
+    reservoir_impl( const ARGS& args )
+      : m_capacity( std::max<size_t>( args[reservoir_size | DEFAULT_RESERVOIR_SIZE], 1 ) ),
+        m_rng( random::thread_generator().next() )
+    {
+        m_samples.reserve( m_capacity );
+    }
+
+    template <typename ARGS>
+    void operator()( const ARGS& args )
+    {
+        m_seen++;
+
+        // Fill phase
+        if( m_samples.size() < m_capacity )
+        {
+            m_samples.push_back( args[boost::accumulators::sample] );
+            if( m_samples.size() == m_capacity )
+            {
+                m_weight = std::exp( std::log( m_rng.uniform() ) / m_capacity );
+                m_next   = m_seen + skip_length();
+            }
+            return;
+        }
+
+        // Skip phase
+        if( m_seen < m_next )
+        {
+            return;
+        }
+
+        m_samples[m_rng.next() % m_capacity] = args[boost::accumulators::sample];
+        m_weight *= std::exp( std::log( m_rng.uniform() ) / m_capacity );
+        m_next    = m_seen + skip_length();
+    }
+
+    result_type result( boost::accumulators::dont_care ) const
+    {
+        return m_samples;
+    }
+
+    template <typename ARCHIVE_TP>
+    void serialize( ARCHIVE_TP& ar, const unsigned int version )
+    {
+        size_t                 capacity = m_capacity;
+        uint64_t               seen     = m_seen;
+        uint64_t               next     = m_next;
+        double                 weight   = m_weight;
+        std::vector<SAMPLE_TP> samples  = m_samples;
+        random::Xorshift64     rng      = m_rng;
+        ar & capacity;
+        ar & seen;
+        ar & next;
+        ar & weight;
+        ar & samples;
+        rng.serialize( ar, version );
+        if( capacity == 0 || samples.size() > capacity )
+        {
+            throw std::runtime_error( "Reservoir checkpoint has an invalid size" );
+        }
+        m_capacity = capacity;
+        m_seen     = seen;
+        m_next     = next;
+        m_weight   = weight;
+        m_samples.swap( samples );
+        m_rng      = rng;
+    }
+
+    private:
+
+        /**
+         * @brief Number of samples until the next replacement
+        */
+        uint64_t skip_length()
+        {
+            double skip = std::floor( std::log( m_rng.uniform() ) / std::log1p( -m_weight ) );
+            if( !( skip < 1e18 ) )
+            {
+                skip = 1e18;
+            }
+            return (uint64_t)skip + 1;
+        }
+
+        /// Max samples retained
+        size_t m_capacity;
+
+        /// Samples seen so far
+        uint64_t m_seen { 0 };
+
+        /// Index of the next sample to keep
+        uint64_t m_next { 0 };
+
+        /// Algorithm L running weight
+        double m_weight { 0 };
+
+        /// Retained samples
+        std::vector<SAMPLE_TP> m_samples;
+
+        random::Xorshift64 m_rng;
+
+}; // End of reservoir_impl
+
+} // End of impl namespace
+
+namespace tag {
+
+/**
+ * @struct reservoir
+ * Feature tag for the uniform reservoir sample
+*/
+struct reservoir : boost::accumulators::depends_on<>
+{
+    typedef acc::impl::reservoir_impl<boost::mpl::_1> impl;
+};
+
+} // End of tag namespace
+
+} // End of acc namespace
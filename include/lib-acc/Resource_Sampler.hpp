@@ -0,0 +1,425 @@
+/**
+ * @file    Resource_Sampler.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+// POSIX Libraries
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+// Project Libraries
+#include "Accumulator.hpp"
+#include "Periodic_Thread.hpp"
+
+namespace acc::proc {
+
+/**
+ * @enum Resource_Metric
+*/
+enum class Resource_Metric : int
+{
+    RSS                  = 0 /*< Resident set size, MiB (/proc/self/status VmRSS)*/,
+    MINOR_FAULTS         = 1 /*< Faults served without I/O (/proc/self/stat)*/,
+    MAJOR_FAULTS         = 2 /*< Faults that needed I/O (/proc/self/stat)*/,
+    VOLUNTARY_SWITCHES   = 3 /*< Blocked and gave up the CPU (getrusage)*/,
+    INVOLUNTARY_SWITCHES = 4 /*< Preempted by the scheduler (getrusage)*/,
+    THREADS              = 5 /*< Threads in the process (/proc/self/stat)*/,
+};
+
+/// Number of Resource_Metric values
+constexpr size_t RESOURCE_METRIC_COUNT = 6;
+
+/**
+ * @brief Printable name of a metric
+*/
+inline std::string to_string( Resource_Metric metric )
+{
+    switch( metric )
+    {
+        case Resource_Metric::RSS:                  return "RSS";
+        case Resource_Metric::MINOR_FAULTS:         return "Minor Faults";
+        case Resource_Metric::MAJOR_FAULTS:         return "Major Faults";
+        case Resource_Metric::VOLUNTARY_SWITCHES:   return "Voluntary Switches";
+        case Resource_Metric::INVOLUNTARY_SWITCHES: return "Involuntary Switches";
+        case Resource_Metric::THREADS:              return "Threads";
+    }
+    return "Unknown";
+}
+
+/**
+ * @brief Unit label of a metric
+*/
+inline std::string units( Resource_Metric metric )
+{
+    switch( metric )
+    {
+        case Resource_Metric::RSS:                  return "MiB";
+        case Resource_Metric::MINOR_FAULTS:         return "faults";
+        case Resource_Metric::MAJOR_FAULTS:         return "faults";
+        case Resource_Metric::VOLUNTARY_SWITCHES:   return "switches";
+        case Resource_Metric::INVOLUNTARY_SWITCHES: return "switches";
+        case Resource_Metric::THREADS:              return "threads";
+    }
+    return "";
+}
+
+/**
+ * @brief Check if a metric is a running total, rather than a level
+*/
+inline bool is_cumulative( Resource_Metric metric )
+{
+    return metric != Resource_Metric::RSS && metric != Resource_Metric::THREADS;
+}
+
+/**
+ * @struct Resource_Reading
+ *
+ * Process counters at one point in time.  Metrics whose source could not be read stay
+ * unavailable.
+*/
+struct Resource_Reading
+{
+    /// Metric values.  RSS is in bytes here.
+    std::array<int64_t,RESOURCE_METRIC_COUNT> values {};
+
+    /// Which entries of values are valid
+    std::array<bool,RESOURCE_METRIC_COUNT> available {};
+
+    int64_t value( Resource_Metric metric ) const
+    {
+        return values[(int)metric];
+    }
+
+    bool has( Resource_Metric metric ) const
+    {
+        return available[(int)metric];
+    }
+
+    void set( Resource_Metric metric, int64_t value )
+    {
+        values[(int)metric]    = value;
+        available[(int)metric] = true;
+    }
+
+}; // End of Resource_Reading Struct
+
+namespace detail {
+
+/**
+ * @brief Read a whole file into a caller buffer, null terminated
+ * @return Bytes read, 0 on failure
+*/
+inline size_t read_file( const char* path, char* buffer, size_t capacity )
+{
+    int fd = ::open( path, O_RDONLY | O_CLOEXEC );
+    if( fd < 0 )
+    {
+        return 0;
+    }
+    size_t total = 0;
+    while( total + 1 < capacity )
+    {
+        auto count = ::read( fd, buffer + total, capacity - 1 - total );
+        if( count <= 0 )
+        {
+            break;
+        }
+        total += (size_t)count;
+    }
+    ::close( fd );
+    buffer[total] = '\0';
+    return total;
+}
+
+/**
+ * @brief Parse the integer starting at text, skipping leading blanks
+*/
+inline bool parse_int( const char* text, const char* end, int64_t& value )
+{
+    while( text < end && ( *text == ' ' || *text == '\t' ) )
+    {
+        text++;
+    }
+    return std::from_chars( text, end, value ).ec == std::errc();
+}
+
+/**
+ * @brief Value of a "Key:  value" line in /proc/self/status
+*/
+inline bool find_status_value( const char* buffer, size_t length, const char* key, int64_t& value )
+{
+    const size_t key_length = std::strlen( key );
+    const char*  end        = buffer + length;
+    for( const char* line = buffer; line < end; )
+    {
+        if( (size_t)( end - line ) > key_length &&
+            std::strncmp( line, key, key_length ) == 0 &&
+            line[key_length] == ':' )
+        {
+            return parse_int( line + key_length + 1, end, value );
+        }
+        auto next = (const char*)std::memchr( line, '\n', end - line );
+        if( !next )
+        {
+            break;
+        }
+        line = next + 1;
+    }
+    return false;
+}
+
+/**
+ * @brief Fields of /proc/self/stat, counted from 1 like proc(5)
+ * @note  Field 2 (comm) may contain spaces, so counting starts after its closing ')'.
+*/
+inline void parse_stat( const char* buffer, size_t length, Resource_Reading& reading )
+{
+    const char* end   = buffer + length;
+    const char* field = nullptr;
+    for( const char* pos = end; pos > buffer; pos-- )
+    {
+        if( pos[-1] == ')' )
+        {
+            field = pos;
+            break;
+        }
+    }
+    if( !field )
+    {
+        return;
+    }
+
+    // Field 3 (state) is the first after the ')'
+    int index = 2;
+    while( field < end )
+    {
+        while( field < end && *field == ' ' )
+        {
+            field++;
+        }
+        index++;
+
+        int64_t value = 0;
+        if( index == 10 && parse_int( field, end, value ) )
+        {
+            reading.set( Resource_Metric::MINOR_FAULTS, value );
+        }
+        else if( index == 12 && parse_int( field, end, value ) )
+        {
+            reading.set( Resource_Metric::MAJOR_FAULTS, value );
+        }
+        else if( index == 20 && parse_int( field, end, value ) )
+        {
+            reading.set( Resource_Metric::THREADS, value );
+            return;
+        }
+
+        while( field < end && *field != ' ' )
+        {
+            field++;
+        }
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * @brief Read the current process counters.  Allocation free.
+*/
+inline Resource_Reading read_resources()
+{
+    Resource_Reading output;
+
+#if defined(__linux__)
+    char buffer[4096];
+    size_t length = detail::read_file( "/proc/self/stat", buffer, sizeof(buffer) );
+    if( length > 0 )
+    {
+        detail::parse_stat( buffer, length, output );
+    }
+
+    length = detail::read_file( "/proc/self/status", buffer, sizeof(buffer) );
+    int64_t rss_kb = 0;
+    if( length > 0 && detail::find_status_value( buffer, length, "VmRSS", rss_kb ) )
+    {
+        output.set( Resource_Metric::RSS, rss_kb * 1024 );
+    }
+#endif
+
+    rusage usage {};
+    if( getrusage( RUSAGE_SELF, &usage ) == 0 )
+    {
+        output.set( Resource_Metric::VOLUNTARY_SWITCHES, usage.ru_nvcsw );
+        output.set( Resource_Metric::INVOLUNTARY_SWITCHES, usage.ru_nivcsw );
+        if( !output.has( Resource_Metric::MINOR_FAULTS ) )
+        {
+            output.set( Resource_Metric::MINOR_FAULTS, usage.ru_minflt );
+            output.set( Resource_Metric::MAJOR_FAULTS, usage.ru_majflt );
+        }
+    }
+    return output;
+}
+
+/**
+ * @class Resource_Sampler
+ *
+ * Reads the process counters every interval, on its own thread or through sample(), and
+ * keeps one rolling Accumulator per metric.  RSS and thread count are recorded as levels;
+ * faults and context switches as the increase since the previous sample, so the rolling
+ * mean is a per-interval rate.  Line these up with latency accumulators to tell memory
+ * growth or scheduling pressure apart from slow code.
+*/
+template <typename FEATURE_SET = ROLLING_FEATURE_SET>
+class Resource_Sampler final
+{
+    public:
+
+        typedef Accumulator<FEATURE_SET,double> ACCUMULATOR_TP;
+
+        /**
+         * @brief Constructor
+         * @param interval     Time between samples on the sampler thread
+         * @param window_size  Samples kept by each rolling accumulator
+        */
+        explicit Resource_Sampler( std::chrono::milliseconds interval    = std::chrono::seconds( 1 ),
+                                   size_t                    window_size = 60 )
+          : m_sampler( interval, [this](){ sample(); }, false )
+        {
+            for( size_t i = 0; i < RESOURCE_METRIC_COUNT; i++ )
+            {
+                m_metrics[i].reset( new ACCUMULATOR_TP( ACCUMULATOR_TP::create_rolling( units( (Resource_Metric)i ), window_size ) ) );
+            }
+            m_previous = read_resources();
+        }
+
+        Resource_Sampler( const Resource_Sampler& ) = delete;
+        Resource_Sampler& operator = ( const Resource_Sampler& ) = delete;
+
+        ~Resource_Sampler()
+        {
+            stop();
+        }
+
+        /**
+         * @brief Start the sampler thread
+        */
+        void start()
+        {
+            m_sampler.start();
+        }
+
+        /**
+         * @brief Stop the sampler thread.  Returns without waiting out the interval.
+        */
+        void stop()
+        {
+            m_sampler.stop();
+        }
+
+        /**
+         * @brief Take one sample now
+        */
+        void sample()
+        {
+            auto current = read_resources();
+
+            std::unique_lock<std::mutex> lck( m_sample_mtx );
+            for( size_t i = 0; i < RESOURCE_METRIC_COUNT; i++ )
+            {
+                auto metric = (Resource_Metric)i;
+                if( !current.has( metric ) )
+                {
+                    continue;
+                }
+                if( metric == Resource_Metric::RSS )
+                {
+                    m_metrics[i]->insert( current.value( metric ) / ( 1024.0 * 1024.0 ) );
+                }
+                else if( !is_cumulative( metric ) )
+                {
+                    m_metrics[i]->insert( (double)current.value( metric ) );
+                }
+                else if( m_previous.has( metric ) )
+                {
+                    m_metrics[i]->insert( (double)( current.value( metric ) - m_previous.value( metric ) ) );
+                }
+            }
+            m_previous = current;
+        }
+
+        /**
+         * @brief Most recent raw reading
+        */
+        Resource_Reading last_reading() const
+        {
+            std::unique_lock<std::mutex> lck( m_sample_mtx );
+            return m_previous;
+        }
+
+        /**
+         * @brief Rolling statistics of one metric
+        */
+        const ACCUMULATOR_TP& get_metric( Resource_Metric metric ) const
+        {
+            return *m_metrics[(int)metric];
+        }
+
+        /**
+         * @brief Print the rolling mean and all-time max of every populated metric
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            for( size_t i = 0; i < RESOURCE_METRIC_COUNT; i++ )
+            {
+                const auto& acc = *m_metrics[i];
+                if( acc.number_items_inserted() == 0 )
+                {
+                    continue;
+                }
+                auto name = to_string( (Resource_Metric)i );
+                auto mean = acc.get_rolling_mean();
+                if( mean )
+                {
+                    sin << PRINTER::to_log_string( name + " Mean", mean.value(), units( (Resource_Metric)i ), precision );
+                }
+                auto max = acc.get_max();
+                if( max )
+                {
+                    sin << PRINTER::to_log_string( name + " All-Time Max", max.value(), units( (Resource_Metric)i ), precision );
+                }
+            }
+            return sin.str();
+        }
+
+    private:
+
+        /// Rolling statistics, by Resource_Metric
+        std::array<std::unique_ptr<ACCUMULATOR_TP>,RESOURCE_METRIC_COUNT> m_metrics;
+
+        /// Reading the deltas are taken against
+        Resource_Reading m_previous;
+
+        mutable std::mutex m_sample_mtx;
+
+        /// Sampler thread, declared last so it stops before the metrics go
+        Periodic_Thread m_sampler;
+
+}; // End of Resource_Sampler Class
+
+} // End of acc::proc namespace
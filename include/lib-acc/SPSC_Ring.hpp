@@ -0,0 +1,139 @@
+/**
+ * @file    SPSC_Ring.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace acc {
+
+/**
+ * @class SPSC_Ring
+ *
+ * Bounded single-producer / single-consumer ring buffer.  Pushing is a slot store plus a
+ * release store of the head index; the consumer's tail index is only re-read when the
+ * cached copy says the ring is full.
+*/
+template <typename T>
+class SPSC_Ring
+{
+    public:
+
+        /**
+         * @brief Create a ring.  Capacity is rounded up to a power of two.
+        */
+        explicit SPSC_Ring( size_t capacity )
+        {
+            size_t actual = 1;
+            while( actual < capacity )
+            {
+                actual <<= 1;
+            }
+            m_mask   = actual - 1;
+            m_buffer = std::make_unique<T[]>( actual );
+        }
+
+        SPSC_Ring( const SPSC_Ring& ) = delete;
+        SPSC_Ring& operator = ( const SPSC_Ring& ) = delete;
+
+        /**
+         * @brief Push a value (producer thread only)
+         * @return False if the ring is full
+        */
+        bool try_push( const T& value )
+        {
+            const size_t head = m_producer.head.load( std::memory_order_relaxed );
+            if( head - m_producer.cached_tail > m_mask )
+            {
+                m_producer.cached_tail = m_consumer.tail.load( std::memory_order_acquire );
+                if( head - m_producer.cached_tail > m_mask )
+                {
+                    return false;
+                }
+            }
+            m_buffer[head & m_mask] = value;
+            m_producer.head.store( head + 1, std::memory_order_release );
+            return true;
+        }
+
+        /**
+         * @brief Hand up to max_items values to the sink as at most two contiguous spans
+         *        (consumer thread only).
+         * @param sink Callable taking (const T* values, size_t count)
+         * @return Number of values consumed
+        */
+        template <typename SINK_TP>
+        size_t consume( SINK_TP&& sink,
+                        size_t    max_items )
+        {
+            const size_t tail  = m_consumer.tail.load( std::memory_order_relaxed );
+            const size_t head  = m_producer.head.load( std::memory_order_acquire );
+            const size_t count = std::min( head - tail, max_items );
+            if( count == 0 )
+            {
+                return 0;
+            }
+
+            const size_t start = tail & m_mask;
+            const size_t first = std::min( count, m_mask + 1 - start );
+            sink( &m_buffer[start], first );
+            if( first < count )
+            {
+                sink( &m_buffer[0], count - first );
+            }
+
+            m_consumer.tail.store( tail + count, std::memory_order_release );
+            return count;
+        }
+
+        /**
+         * @brief Approximate number of queued values
+        */
+        size_t size() const
+        {
+            return m_producer.head.load( std::memory_order_acquire ) - m_consumer.tail.load( std::memory_order_acquire );
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        size_t capacity() const
+        {
+            return m_mask + 1;
+        }
+
+    private:
+
+        /// Producer-owned indices, kept off the consumer's cache line
+        struct alignas(64) Producer_State
+        {
+            std::atomic<size_t> head { 0 };
+            size_t cached_tail { 0 };
+        };
+
+        /// Consumer-owned index
+        struct alignas(64) Consumer_State
+        {
+            std::atomic<size_t> tail { 0 };
+        };
+
+        Producer_State m_producer;
+        Consumer_State m_consumer;
+
+        /// Capacity - 1
+        size_t m_mask;
+
+        /// Slot storage
+        std::unique_ptr<T[]> m_buffer;
+
+}; // End of SPSC_Ring Class
+
+} // End of acc namespace
@@ -0,0 +1,376 @@
+/**
+ * @file    Sampled_Accumulator.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+// Project Libraries
+#include "Accumulator.hpp"
+#include "Fast_Random.hpp"
+#include "Print_Utilities.hpp"
+
+namespace acc {
+
+/**
+ * @enum Sampling_Mode
+*/
+enum class Sampling_Mode : int
+{
+    EVERY_NTH     = 0 /*< Keep exactly one of every N samples*/,
+    PROBABILISTIC = 1 /*< Keep each sample with fixed probability p*/,
+    RATE_LIMITED  = 2 /*< Adjust p so roughly a target number of samples/sec are kept*/,
+};
+
+/**
+ * @class Sampled_Accumulator
+ *
+ * Wraps an Accumulator and only forwards a subset of the offered samples.  Every offered
+ * sample is counted, so the count is exact, and sums are scaled by 1/p (Horvitz-Thompson)
+ * with a running variance estimate so the error bound is known.  Mean, min, max and
+ * variance come from the kept samples.
+*/
+template <typename FEATURE_SET = FULL_FEATURE_SET,
+          typename SAMPLE_TP = double>
+class Sampled_Accumulator final
+{
+    public:
+
+        typedef std::chrono::steady_clock Clock;
+
+        /**
+         * @brief Keep one of every n samples
+        */
+        static Sampled_Accumulator<FEATURE_SET,SAMPLE_TP> create_every_nth( const std::string& units,
+                                                                             uint64_t           n )
+        {
+            return Sampled_Accumulator<FEATURE_SET,SAMPLE_TP>( units,
+                                                               Sampling_Mode::EVERY_NTH,
+                                                               1.0 / std::max<uint64_t>( n, 1 ),
+                                                               std::max<uint64_t>( n, 1 ),
+                                                               0,
+                                                               Clock::duration::zero() );
+        }
+
+        /**
+         * @brief Keep each sample with the given probability
+        */
+        static Sampled_Accumulator<FEATURE_SET,SAMPLE_TP> create_probabilistic( const std::string& units,
+                                                                                double             probability )
+        {
+            return Sampled_Accumulator<FEATURE_SET,SAMPLE_TP>( units,
+                                                               Sampling_Mode::PROBABILISTIC,
+                                                               probability,
+                                                               1,
+                                                               0,
+                                                               Clock::duration::zero() );
+        }
+
+        /**
+         * @brief Adapt the sampling probability to keep about target_rate samples per second
+         * @param adjust_interval How often the offered rate is re-measured
+        */
+        static Sampled_Accumulator<FEATURE_SET,SAMPLE_TP> create_rate_limited( const std::string&         units,
+                                                                               double                     target_rate,
+                                                                               std::chrono::milliseconds  adjust_interval = std::chrono::milliseconds( 100 ) )
+        {
+            return Sampled_Accumulator<FEATURE_SET,SAMPLE_TP>( units,
+                                                               Sampling_Mode::RATE_LIMITED,
+                                                               1.0,
+                                                               1,
+                                                               target_rate,
+                                                               adjust_interval );
+        }
+
+        /**
+         * @brief Offer a sample.  Rejected samples cost a counter bump and one PRNG draw.
+        */
+        void insert( SAMPLE_TP new_value )
+        {
+            const uint64_t offered = m_offered.fetch_add( 1, std::memory_order_relaxed ) + 1;
+
+            if( m_mode == Sampling_Mode::EVERY_NTH )
+            {
+                if( offered % m_every_n != 0 )
+                {
+                    return;
+                }
+                record( new_value, m_probability.load( std::memory_order_relaxed ) );
+                return;
+            }
+
+            if( m_mode == Sampling_Mode::RATE_LIMITED && ( offered % RATE_CHECK_INTERVAL ) == 0 )
+            {
+                adjust_rate();
+            }
+
+            const double probability = m_probability.load( std::memory_order_relaxed );
+            if( probability < 1 &&
+                random::thread_generator().uniform() >= probability )
+            {
+                return;
+            }
+            const uint64_t kept = record( new_value, probability );
+
+            // Check again every few kept samples, or as soon as this window's budget is spent
+            if( m_mode == Sampling_Mode::RATE_LIMITED &&
+                ( kept % KEPT_CHECK_INTERVAL == 0 || kept >= m_window_budget ) )
+            {
+                adjust_rate();
+            }
+        }
+
+        template<typename REP_TYPE,
+                 typename RATIO_TYPE>
+        void insert( const std::chrono::duration<REP_TYPE,RATIO_TYPE>& duration )
+        {
+            insert( (SAMPLE_TP)duration.count() );
+        }
+
+        /**
+         * @brief Accumulator holding the kept samples
+        */
+        const Accumulator<FEATURE_SET,SAMPLE_TP>& get_sampled_accumulator() const
+        {
+            return m_accumulator;
+        }
+
+        /**
+         * @brief Exact number of samples offered
+        */
+        int64_t get_offered_count() const
+        {
+            return m_offered.load( std::memory_order_relaxed );
+        }
+
+        /**
+         * @brief Number of samples kept
+        */
+        int64_t get_sampled_count() const
+        {
+            return m_accumulator.number_items_inserted();
+        }
+
+        /**
+         * @brief Fraction of offered samples actually kept
+        */
+        double get_effective_sampling_rate() const
+        {
+            auto offered = get_offered_count();
+            if( offered == 0 )
+            {
+                return 1;
+            }
+            return get_sampled_count() / (double)offered;
+        }
+
+        /**
+         * @brief Probability currently applied to new samples
+        */
+        double get_sampling_probability() const
+        {
+            return m_probability.load( std::memory_order_relaxed );
+        }
+
+        /**
+         * @brief Estimated sum of every offered sample
+        */
+        double get_estimated_sum() const
+        {
+            std::unique_lock<std::mutex> lck( m_est_mtx );
+            return m_est_sum;
+        }
+
+        /**
+         * @brief Standard error of get_estimated_sum()
+         * @note  Assumes each sample was kept independently, so it only holds for the random
+         *        modes.  EVERY_NTH is systematic sampling and returns NaN.
+        */
+        double get_estimated_sum_std_error() const
+        {
+            if( m_mode == Sampling_Mode::EVERY_NTH )
+            {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            std::unique_lock<std::mutex> lck( m_est_mtx );
+            return std::sqrt( m_est_sum_variance );
+        }
+
+        /**
+         * @brief Estimated number of samples, recovered from the kept samples alone.
+         * @note  Compare against get_offered_count() to sanity check the sampler.
+        */
+        double get_estimated_count() const
+        {
+            std::unique_lock<std::mutex> lck( m_est_mtx );
+            return m_est_count;
+        }
+
+        /**
+         * @brief Print to log string
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            sin << PRINTER::to_log_string( "Offered Count",
+                                           get_offered_count(),
+                                           "",
+                                           precision );
+            sin << PRINTER::to_log_string( "Sampling Rate",
+                                           get_effective_sampling_rate(),
+                                           "",
+                                           precision );
+            sin << PRINTER::to_log_string( "Est. Sum",
+                                           get_estimated_sum(),
+                                           m_units,
+                                           precision );
+            if( m_mode != Sampling_Mode::EVERY_NTH )
+            {
+                sin << PRINTER::to_log_string( "Est. Sum StdErr",
+                                               get_estimated_sum_std_error(),
+                                               m_units,
+                                               precision );
+            }
+            sin << m_accumulator.template toLogString<acc::print::Prefixed_Printer<PRINTER,Kept_Prefix>>( precision );
+            return sin.str();
+        }
+
+    private:
+
+        /// Offers between rate checks when few samples are being kept
+        static constexpr uint64_t RATE_CHECK_INTERVAL = 256;
+
+        /// Kept samples between rate checks
+        static constexpr uint64_t KEPT_CHECK_INTERVAL = 64;
+
+        /// Labels the kept-sample block of toLogString() apart from the estimates
+        struct Kept_Prefix
+        {
+            static constexpr const char* prefix = "Kept";
+        };
+
+        explicit Sampled_Accumulator( const std::string&  units,
+                                      Sampling_Mode       mode,
+                                      double              probability,
+                                      uint64_t            every_n,
+                                      double              target_rate,
+                                      Clock::duration     adjust_interval )
+          : m_mode( mode ),
+            m_every_n( every_n ),
+            m_target_rate( target_rate ),
+            m_adjust_interval( adjust_interval ),
+            m_window_budget( target_rate * std::chrono::duration<double>( adjust_interval ).count() ),
+            m_probability( std::clamp( probability, std::numeric_limits<double>::min(), 1.0 ) ),
+            m_window_start( Clock::now() ),
+            m_accumulator( Accumulator<FEATURE_SET,SAMPLE_TP>::create( units ) ),
+            m_units( units )
+        {
+        }
+
+        /**
+         * @brief Forward a kept sample and update the scaled estimates
+         * @return Samples kept in the current rate window, this one included
+        */
+        uint64_t record( SAMPLE_TP new_value, double probability )
+        {
+            m_accumulator.insert( new_value );
+            const uint64_t kept = m_window_kept.fetch_add( 1, std::memory_order_relaxed ) + 1;
+
+            const double weight = 1.0 / probability;
+            const double value  = (double)new_value;
+            std::unique_lock<std::mutex> lck( m_est_mtx );
+            m_est_count        += weight;
+            m_est_sum          += value * weight;
+            m_est_sum_variance += ( 1.0 - probability ) * weight * weight * value * value;
+            return kept;
+        }
+
+        /**
+         * @brief Re-measure the offered rate and retune the probability (rate-limited mode)
+        */
+        void adjust_rate()
+        {
+            std::unique_lock<std::mutex> lck( m_rate_mtx, std::try_to_lock );
+            if( !lck )
+            {
+                return;
+            }
+
+            // Re-measure once the interval has passed, or early if this window's budget is spent
+            auto now = Clock::now();
+            auto elapsed = now - m_window_start;
+            if( elapsed <= Clock::duration::zero() ||
+                ( elapsed < m_adjust_interval && m_window_kept < m_window_budget ) )
+            {
+                return;
+            }
+
+            const uint64_t offered = m_offered.load( std::memory_order_relaxed );
+            const double seconds = std::chrono::duration<double>( elapsed ).count();
+            const double offered_rate = ( offered - m_window_offered ) / seconds;
+            if( offered_rate > 0 )
+            {
+                m_probability.store( std::clamp( m_target_rate / offered_rate,
+                                                 std::numeric_limits<double>::min(),
+                                                 1.0 ),
+                                     std::memory_order_relaxed );
+            }
+            m_window_start   = now;
+            m_window_offered = offered;
+            m_window_kept    = 0;
+        }
+
+        /// Sampling mode
+        Sampling_Mode m_mode;
+
+        /// N for EVERY_NTH mode
+        uint64_t m_every_n;
+
+        /// Target kept samples per second for RATE_LIMITED mode
+        double m_target_rate;
+
+        /// Rate re-measurement interval for RATE_LIMITED mode
+        Clock::duration m_adjust_interval;
+
+        /// Kept samples allowed per interval for RATE_LIMITED mode
+        double m_window_budget;
+
+        /// Current keep probability
+        std::atomic<double> m_probability;
+
+        /// Number of samples offered
+        std::atomic<uint64_t> m_offered { 0 };
+
+        /// Rate-measurement window
+        Clock::time_point m_window_start;
+        uint64_t m_window_offered { 0 };
+        std::atomic<uint64_t> m_window_kept { 0 };
+        std::mutex m_rate_mtx;
+
+        /// Horvitz-Thompson estimates
+        double m_est_count { 0 };
+        double m_est_sum { 0 };
+        double m_est_sum_variance { 0 };
+        mutable std::mutex m_est_mtx;
+
+        /// Kept samples
+        Accumulator<FEATURE_SET,SAMPLE_TP> m_accumulator;
+
+        /// Unit of measure
+        std::string m_units;
+
+}; // End of Sampled_Accumulator Class
+
+} // End of acc namespace
@@ -0,0 +1,192 @@
+/**
+ * @file    Split_Stopwatch.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <sstream>
+#include <string>
+
+// Project Libraries
+#include "Accumulator.hpp"
+#include "CPU_Clock.hpp"
+#include "Print_Utilities.hpp"
+
+namespace acc {
+
+/**
+ * @struct Split_Time
+ *
+ * Wall and CPU time of one timed region
+*/
+struct Split_Time
+{
+    /// Elapsed wall-clock time
+    std::chrono::nanoseconds wall { 0 };
+
+    /// CPU time used by the thread over the same span
+    std::chrono::nanoseconds cpu { 0 };
+
+    /**
+     * @brief Time spent waiting:  locks, I/O, or preempted.  Never negative.
+    */
+    std::chrono::nanoseconds off_cpu() const
+    {
+        return std::max( wall - cpu, std::chrono::nanoseconds( 0 ) );
+    }
+
+}; // End of Split_Time Struct
+
+/**
+ * @class Split_Stopwatch
+ *
+ * Stopwatch that reads the steady clock and the thread CPU-time clock together.  Must be
+ * stopped on the thread that started it.
+*/
+class Split_Stopwatch
+{
+    public:
+
+        Split_Stopwatch()
+        {
+            start();
+        }
+
+        /**
+         * @brief Reset the start times
+        */
+        void start()
+        {
+            m_wall_start = std::chrono::steady_clock::now();
+            m_cpu_start  = Thread_CPU_Clock::now();
+        }
+
+        /**
+         * @brief Time since start
+        */
+        Split_Time stop() const
+        {
+            Split_Time output;
+            output.cpu  = Thread_CPU_Clock::now() - m_cpu_start;
+            output.wall = std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - m_wall_start );
+            return output;
+        }
+
+    private:
+
+        /// Start Times
+        std::chrono::steady_clock::time_point m_wall_start;
+        Thread_CPU_Clock::time_point          m_cpu_start;
+
+}; // End of Split_Stopwatch Class
+
+/**
+ * @class Split_Timing_Accumulator
+ *
+ * Wall, CPU and off-CPU time of a region in three accumulators.  A high off-CPU share
+ * means the region is waiting (contention, I/O) rather than computing.
+*/
+template <typename FEATURE_SET = FULL_FEATURE_SET,
+          typename DURATION_TP = std::chrono::duration<double,std::milli>>
+class Split_Timing_Accumulator final
+{
+    public:
+
+        typedef Accumulator<FEATURE_SET,double> ACCUMULATOR_TP;
+
+        static Split_Timing_Accumulator<FEATURE_SET,DURATION_TP> create( const std::string& units = "ms" )
+        {
+            return Split_Timing_Accumulator<FEATURE_SET,DURATION_TP>( units );
+        }
+
+        /**
+         * @brief Add one timed region
+        */
+        void insert( const Split_Time& split )
+        {
+            m_wall.insert( std::chrono::duration_cast<DURATION_TP>( split.wall ).count() );
+            m_cpu.insert( std::chrono::duration_cast<DURATION_TP>( split.cpu ).count() );
+            m_off_cpu.insert( std::chrono::duration_cast<DURATION_TP>( split.off_cpu() ).count() );
+        }
+
+        const ACCUMULATOR_TP& get_wall() const
+        {
+            return m_wall;
+        }
+
+        const ACCUMULATOR_TP& get_cpu() const
+        {
+            return m_cpu;
+        }
+
+        const ACCUMULATOR_TP& get_off_cpu() const
+        {
+            return m_off_cpu;
+        }
+
+        /**
+         * @brief Fraction of the total wall time spent off-CPU, once anything was recorded
+        */
+        std::optional<double> get_off_cpu_fraction() const
+        {
+            auto wall    = m_wall.get_sum();
+            auto off_cpu = m_off_cpu.get_sum();
+            if( !wall || !off_cpu || !( wall.value() > 0 ) )
+            {
+                return {};
+            }
+            return off_cpu.value() / wall.value();
+        }
+
+        /**
+         * @brief Print to log string
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            if( m_wall.number_items_inserted() == 0 )
+            {
+                return sin.str();
+            }
+            acc::print::print_summary<PRINTER>( sin, "Wall", m_wall, m_units, precision, acc::print::SUMMARY_ALL );
+            acc::print::print_summary<PRINTER>( sin, "CPU", m_cpu, m_units, precision, acc::print::SUMMARY_ALL );
+            acc::print::print_summary<PRINTER>( sin, "Off-CPU", m_off_cpu, m_units, precision, acc::print::SUMMARY_ALL );
+
+            auto fraction = get_off_cpu_fraction();
+            if( fraction )
+            {
+                sin << PRINTER::to_log_string( "Off-CPU Fraction",
+                                               fraction.value(),
+                                               "",
+                                               precision );
+            }
+            return sin.str();
+        }
+
+    private:
+
+        explicit Split_Timing_Accumulator( const std::string& units )
+          : m_wall( ACCUMULATOR_TP::create( units ) ),
+            m_cpu( ACCUMULATOR_TP::create( units ) ),
+            m_off_cpu( ACCUMULATOR_TP::create( units ) ),
+            m_units( units )
+        {
+        }
+
+        /// Wall, CPU and off-CPU time per region
+        ACCUMULATOR_TP m_wall;
+        ACCUMULATOR_TP m_cpu;
+        ACCUMULATOR_TP m_off_cpu;
+
+        /// Unit of measure
+        std::string m_units;
+
+}; // End of Split_Timing_Accumulator Class
+
+} // End of acc namespace
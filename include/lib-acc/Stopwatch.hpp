@@ -32,7 +32,7 @@ class Stopwatch
         }
 
         template <typename DUR_TYPE = std::chrono::milliseconds>
-        DUR_TYPE stop()
+        DUR_TYPE stop() const
         {
             return std::chrono::duration_cast<DUR_TYPE>( CLOCK_TP::now() - m_start_time );
         }
@@ -0,0 +1,89 @@
+/**
+ * @file    Summary_Stats.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace acc {
+
+/**
+ * @struct Summary_Stats
+ *
+ * Count, sum, sum of squares, min and max of a set of samples.  Mergeable.
+*/
+struct Summary_Stats
+{
+    /// Number of samples
+    int64_t count { 0 };
+
+    /// Sum of samples
+    double sum { 0 };
+
+    /// Sum of squared samples
+    double sum_squares { 0 };
+
+    /// Smallest sample
+    double min { std::numeric_limits<double>::infinity() };
+
+    /// Largest sample
+    double max { -std::numeric_limits<double>::infinity() };
+
+    /**
+     * @brief Add one sample
+    */
+    void insert( double value )
+    {
+        count++;
+        sum         += value;
+        sum_squares += value * value;
+        min          = std::min( min, value );
+        max          = std::max( max, value );
+    }
+
+    /**
+     * @brief Combine another summary into this one
+    */
+    void merge( const Summary_Stats& other )
+    {
+        count       += other.count;
+        sum         += other.sum;
+        sum_squares += other.sum_squares;
+        min          = std::min( min, other.min );
+        max          = std::max( max, other.max );
+    }
+
+    /**
+     * @brief Get the mean, if any samples were seen
+    */
+    std::optional<double> mean() const
+    {
+        if( count == 0 )
+        {
+            return {};
+        }
+        return sum / count;
+    }
+
+    /**
+     * @brief Get the (population) variance, if any samples were seen
+    */
+    std::optional<double> variance() const
+    {
+        if( count == 0 )
+        {
+            return {};
+        }
+        const double mean_value = sum / count;
+        return std::max( sum_squares / count - mean_value * mean_value, 0.0 );
+    }
+
+}; // End of Summary_Stats Struct
+
+} // End of acc namespace
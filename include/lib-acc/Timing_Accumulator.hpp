@@ -0,0 +1,285 @@
+/**
+ * @file    Timing_Accumulator.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <ratio>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+// Project Libraries
+#include "Pretty_Printer.hpp"
+#include "Shell_Printer.hpp"
+
+namespace acc {
+
+/**
+ * @brief Unit label for a std::chrono period
+*/
+template <typename PERIOD_TP>
+std::string duration_units()
+{
+    if constexpr ( std::is_same_v<PERIOD_TP,std::nano> )       { return "ns"; }
+    else if constexpr ( std::is_same_v<PERIOD_TP,std::micro> ) { return "us"; }
+    else if constexpr ( std::is_same_v<PERIOD_TP,std::milli> ) { return "ms"; }
+    else if constexpr ( std::is_same_v<PERIOD_TP,std::ratio<1>> ) { return "s"; }
+    else if constexpr ( std::is_same_v<PERIOD_TP,std::ratio<60>> ) { return "min"; }
+    else { return std::to_string( PERIOD_TP::num ) + "/" + std::to_string( PERIOD_TP::den ) + " s"; }
+}
+
+/**
+ * @class Timing_Accumulator
+ *
+ * Timing statistics kept as integer nanoseconds.  Sum, min and max are int64, and the sum
+ * of squares is a 128-bit integer, so totals are exact and variance carries no rounding
+ * error until report time.  Conversion to DISPLAY_DURATION only happens in the getters.
+*/
+template <typename DISPLAY_DURATION = std::chrono::duration<double,std::milli>>
+class Timing_Accumulator final
+{
+    public:
+
+        typedef DISPLAY_DURATION DISPLAY_DURATION_TP;
+
+        /**
+         * @brief Create a timing accumulator.  Units default to the display duration's period.
+        */
+        static Timing_Accumulator<DISPLAY_DURATION> create( const std::string& units = duration_units<typename DISPLAY_DURATION::period>() )
+        {
+            return Timing_Accumulator<DISPLAY_DURATION>( units );
+        }
+
+        /**
+         * @brief Add a duration
+        */
+        template<typename REP_TYPE,
+                 typename RATIO_TYPE>
+        void insert( const std::chrono::duration<REP_TYPE,RATIO_TYPE>& duration )
+        {
+            insert_ns( std::chrono::duration_cast<std::chrono::nanoseconds>( duration ).count() );
+        }
+
+        /**
+         * @brief Add a raw nanosecond count
+        */
+        void insert_ns( int64_t nanoseconds )
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            m_count++;
+            m_sum_ns    += nanoseconds;
+            m_sum_sq_ns += (__int128)nanoseconds * nanoseconds;
+            m_min_ns     = std::min( m_min_ns, nanoseconds );
+            m_max_ns     = std::max( m_max_ns, nanoseconds );
+            m_last_ns    = nanoseconds;
+        }
+
+        /**
+         * @brief Get the number of items inserted
+        */
+        int64_t get_count() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_count;
+        }
+
+        /**
+         * @brief Exact total in nanoseconds
+        */
+        int64_t get_sum_ns() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return m_sum_ns;
+        }
+
+        /**
+         * @brief Get the sum
+        */
+        DISPLAY_DURATION get_sum() const
+        {
+            return to_display( (long double)get_sum_ns() );
+        }
+
+        /**
+         * @brief Get the mean, if anything was inserted
+        */
+        std::optional<DISPLAY_DURATION> get_mean() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_count == 0 )
+            {
+                return {};
+            }
+            return to_display( (long double)m_sum_ns / m_count );
+        }
+
+        /**
+         * @brief Get the min value, if anything was inserted
+        */
+        std::optional<DISPLAY_DURATION> get_min() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_count == 0 )
+            {
+                return {};
+            }
+            return to_display( (long double)m_min_ns );
+        }
+
+        /**
+         * @brief Get the max value, if anything was inserted
+        */
+        std::optional<DISPLAY_DURATION> get_max() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_count == 0 )
+            {
+                return {};
+            }
+            return to_display( (long double)m_max_ns );
+        }
+
+        /**
+         * @brief Get the population variance in squared display units
+        */
+        std::optional<double> get_variance() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            if( m_count == 0 )
+            {
+                return {};
+            }
+
+            // sum_sq - sum^2/n, with the division split into quotient and remainder so the
+            // only rounding is the final conversion.  sum^2 fits while sum fits in int64.
+            const __int128 sum_squared = (__int128)m_sum_ns * m_sum_ns;
+            const __int128 quotient    = sum_squared / m_count;
+            const __int128 remainder   = sum_squared % m_count;
+            const long double var_ns2  = ( (long double)( m_sum_sq_ns - quotient ) - (long double)remainder / m_count ) / m_count;
+
+            const long double scale = to_display( 1.0L ).count();
+            return (double)( var_ns2 * scale * scale );
+        }
+
+        /**
+         * @brief Get the standard deviation
+        */
+        std::optional<DISPLAY_DURATION> get_stddev() const
+        {
+            auto variance = get_variance();
+            if( !variance )
+            {
+                return {};
+            }
+            return DISPLAY_DURATION( std::sqrt( std::max( variance.value(), 0.0 ) ) );
+        }
+
+        /**
+         * @brief Get the last entry inserted
+        */
+        DISPLAY_DURATION last_entry() const
+        {
+            std::unique_lock<std::mutex> lck(m_acc_mtx);
+            return to_display( (long double)m_last_ns );
+        }
+
+        /**
+         * @brief Print to log string
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+
+            if( get_count() <= 0 )
+            {
+                std::cerr << "No Entries Accumulated." << std::endl;
+                return sin.str();
+            }
+
+            sin << PRINTER::to_log_string( "Count",
+                                           get_count(),
+                                           "",
+                                           precision );
+            sin << PRINTER::to_log_string( "Mean",
+                                           get_mean().value().count(),
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "Min",
+                                           get_min().value().count(),
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "Max",
+                                           get_max().value().count(),
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "StdDev",
+                                           get_stddev().value().count(),
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "Variance",
+                                           get_variance().value(),
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "Sum",
+                                           get_sum().count(),
+                                           m_units,
+                                           precision );
+            sin << PRINTER::to_log_string( "Last Entry",
+                                           last_entry().count(),
+                                           m_units,
+                                           precision );
+            return sin.str();
+        }
+
+    private:
+
+        explicit Timing_Accumulator( const std::string& units )
+          : m_units( units )
+        {
+        }
+
+        /**
+         * @brief Convert nanoseconds to the display duration
+        */
+        static DISPLAY_DURATION to_display( long double nanoseconds )
+        {
+            return std::chrono::duration_cast<DISPLAY_DURATION>( std::chrono::duration<long double,std::nano>( nanoseconds ) );
+        }
+
+        /// Number of items inserted
+        int64_t m_count { 0 };
+
+        /// Sum of samples (ns)
+        int64_t m_sum_ns { 0 };
+
+        /// Sum of squared samples (ns^2)
+        __int128 m_sum_sq_ns { 0 };
+
+        /// Min / Max (ns)
+        int64_t m_min_ns { std::numeric_limits<int64_t>::max() };
+        int64_t m_max_ns { std::numeric_limits<int64_t>::min() };
+
+        /// Last Entry Pushed (ns)
+        int64_t m_last_ns { 0 };
+
+        /// Unit of measure
+        std::string m_units;
+
+        /// Access Mutex
+        mutable std::mutex m_acc_mtx;
+
+}; // End of Timing_Accumulator Class
+
+} // End of acc namespace
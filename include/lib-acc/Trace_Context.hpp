@@ -0,0 +1,314 @@
+/**
+ * @file    Trace_Context.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Project Libraries
+#include "Pretty_Printer.hpp"
+#include "Timing_Accumulator.hpp"
+
+namespace acc::trace {
+
+class Trace_Span;
+
+/**
+ * @struct Trace_Context
+ *
+ * What a thread is working on.  Copy it when handing work to another thread and install it
+ * there with a Context_Guard, so spans and zones attach to the originating request.
+*/
+struct Trace_Context
+{
+    /// Innermost open span, or null
+    Trace_Span* span { nullptr };
+
+}; // End of Trace_Context Struct
+
+namespace detail {
+
+inline thread_local Trace_Context t_context;
+
+/// Source of trace IDs for root spans
+inline std::atomic<uint64_t> g_next_trace_id { 1 };
+
+} // End of detail namespace
+
+/**
+ * @brief Context of the calling thread
+*/
+inline Trace_Context current_context()
+{
+    return detail::t_context;
+}
+
+/**
+ * @class Context_Guard
+ *
+ * Installs a context on the calling thread and restores the previous one on destruction.
+*/
+class Context_Guard final
+{
+    public:
+
+        explicit Context_Guard( const Trace_Context& context )
+          : m_previous( detail::t_context )
+        {
+            detail::t_context = context;
+        }
+
+        ~Context_Guard()
+        {
+            detail::t_context = m_previous;
+        }
+
+        Context_Guard( const Context_Guard& ) = delete;
+        Context_Guard& operator = ( const Context_Guard& ) = delete;
+
+    private:
+
+        Trace_Context m_previous;
+
+}; // End of Context_Guard Class
+
+/**
+ * @class Trace_Span
+ *
+ * A request, or one step of it, timed from construction to destruction.  While open it is
+ * the calling thread's current span, and the span open when it was created is its parent.
+ * On close its wall time is recorded into the parent's breakdown under its name.
+ *
+ * The breakdown holds the zones and child spans recorded against this span, from any thread
+ * the context reached, plus the time tasks submitted under it waited in a queue.  Fanned-out
+ * work runs in parallel, so breakdown sums can exceed the span's wall time.
+ *
+ * @note  A span must outlive every task submitted under it, ex: wait on their futures
+ *        before the span goes out of scope.
+*/
+class Trace_Span final
+{
+    public:
+
+        typedef std::chrono::steady_clock                 CLOCK_TP;
+        typedef std::chrono::duration<double,std::milli>  DISPLAY_DURATION;
+        typedef Timing_Accumulator<DISPLAY_DURATION>      TIMING_TP;
+
+        /**
+         * @brief Open a span under the current one
+         * @param trace_id  ID for a root span; 0 assigns the next one.  Children inherit their root's.
+        */
+        explicit Trace_Span( const std::string& name,
+                             uint64_t           trace_id = 0 )
+          : m_name( name ),
+            m_parent( detail::t_context.span ),
+            m_trace_id( m_parent != nullptr ? m_parent->trace_id()
+                                            : ( trace_id != 0 ? trace_id : detail::g_next_trace_id.fetch_add( 1, std::memory_order_relaxed ) ) ),
+            m_queue_wait( TIMING_TP::create() ),
+            m_guard( Trace_Context{ this } ),
+            m_start( CLOCK_TP::now() )
+        {
+        }
+
+        /**
+         * @brief Close the span and report it to the parent
+        */
+        ~Trace_Span()
+        {
+            const auto elapsed = CLOCK_TP::now() - m_start;
+            if( m_parent != nullptr )
+            {
+                m_parent->record( m_name, elapsed );
+            }
+        }
+
+        Trace_Span( const Trace_Span& ) = delete;
+        Trace_Span& operator = ( const Trace_Span& ) = delete;
+
+        const std::string& name() const
+        {
+            return m_name;
+        }
+
+        const Trace_Span* parent() const
+        {
+            return m_parent;
+        }
+
+        uint64_t trace_id() const
+        {
+            return m_trace_id;
+        }
+
+        /**
+         * @brief Time since the span opened
+        */
+        DISPLAY_DURATION elapsed() const
+        {
+            return std::chrono::duration_cast<DISPLAY_DURATION>( CLOCK_TP::now() - m_start );
+        }
+
+        /**
+         * @brief Add time to the named entry of the breakdown.  Safe from any thread.
+        */
+        template<typename REP_TYPE,
+                 typename RATIO_TYPE>
+        void record( const char*                                       name,
+                     const std::chrono::duration<REP_TYPE,RATIO_TYPE>& duration )
+        {
+            const int64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>( duration ).count();
+            std::unique_lock<std::mutex> lck( m_breakdown_mtx );
+            for( auto& entry : m_breakdown )
+            {
+                if( entry.first == name )
+                {
+                    entry.second->insert_ns( nanoseconds );
+                    return;
+                }
+            }
+            m_breakdown.emplace_back( name, std::unique_ptr<TIMING_TP>( new TIMING_TP( TIMING_TP::create() ) ) );
+            m_breakdown.back().second->insert_ns( nanoseconds );
+        }
+
+        template<typename REP_TYPE,
+                 typename RATIO_TYPE>
+        void record( const std::string&                                name,
+                     const std::chrono::duration<REP_TYPE,RATIO_TYPE>& duration )
+        {
+            record( name.c_str(), duration );
+        }
+
+        /**
+         * @brief Add the time a task submitted under this span waited to start
+        */
+        template<typename REP_TYPE,
+                 typename RATIO_TYPE>
+        void record_queue_wait( const std::chrono::duration<REP_TYPE,RATIO_TYPE>& duration )
+        {
+            m_queue_wait.insert( duration );
+        }
+
+        /**
+         * @brief Breakdown entry, or null if nothing was recorded under that name
+         * @note  Entries are never removed, so the pointer stays valid for the span's life.
+        */
+        const TIMING_TP* get_breakdown( const std::string& name ) const
+        {
+            std::unique_lock<std::mutex> lck( m_breakdown_mtx );
+            for( const auto& entry : m_breakdown )
+            {
+                if( entry.first == name )
+                {
+                    return entry.second.get();
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Queue wait of the tasks submitted under this span
+        */
+        const TIMING_TP& get_queue_wait() const
+        {
+            return m_queue_wait;
+        }
+
+        /**
+         * @brief Print the span and its breakdown.  Sums are shown, since they add up across tasks.
+        */
+        template <typename PRINTER = acc::print::pretty::Printer>
+        std::string toLogString( int precision = 6 ) const
+        {
+            std::stringstream sin;
+            sin << PRINTER::to_log_string( m_name + " Elapsed", elapsed().count(), "ms", precision );
+            if( m_queue_wait.get_count() > 0 )
+            {
+                sin << PRINTER::to_log_string( m_name + " Queue Wait", m_queue_wait.get_sum().count(),
+                                               "ms (" + std::to_string( m_queue_wait.get_count() ) + " tasks)", precision );
+            }
+
+            std::unique_lock<std::mutex> lck( m_breakdown_mtx );
+            for( const auto& entry : m_breakdown )
+            {
+                sin << PRINTER::to_log_string( m_name + " / " + entry.first, entry.second->get_sum().count(),
+                                               "ms (" + std::to_string( entry.second->get_count() ) + "x, max " +
+                                               std::to_string( entry.second->get_max().value().count() ) + " ms)",
+                                               precision );
+            }
+            return sin.str();
+        }
+
+    private:
+
+        /// Name in the parent's breakdown
+        std::string m_name;
+
+        Trace_Span* m_parent;
+        uint64_t    m_trace_id;
+
+        /// Zones and child spans by name, in first-recorded order
+        std::vector<std::pair<std::string,std::unique_ptr<TIMING_TP>>> m_breakdown;
+        mutable std::mutex m_breakdown_mtx;
+
+        TIMING_TP m_queue_wait;
+
+        /// Makes this the current span while open
+        Context_Guard m_guard;
+
+        CLOCK_TP::time_point m_start;
+
+}; // End of Trace_Span Class
+
+/**
+ * @class Trace_Zone
+ *
+ * Cheap timed section, recorded into the current span's breakdown on destruction.  Does
+ * nothing but read the clock twice when there is no current span, ex:
+ *
+ *   { acc::trace::Trace_Zone zone( "Encode" );  encode(); }
+*/
+class Trace_Zone final
+{
+    public:
+
+        /**
+         * @param name  Must outlive the zone, ex: a string literal
+        */
+        explicit Trace_Zone( const char* name )
+          : m_name( name ),
+            m_span( detail::t_context.span ),
+            m_start( Trace_Span::CLOCK_TP::now() )
+        {
+        }
+
+        ~Trace_Zone()
+        {
+            if( m_span != nullptr )
+            {
+                m_span->record( m_name, Trace_Span::CLOCK_TP::now() - m_start );
+            }
+        }
+
+        Trace_Zone( const Trace_Zone& ) = delete;
+        Trace_Zone& operator = ( const Trace_Zone& ) = delete;
+
+    private:
+
+        const char* m_name;
+        Trace_Span* m_span;
+        Trace_Span::CLOCK_TP::time_point m_start;
+
+}; // End of Trace_Zone Class
+
+} // End of acc::trace namespace
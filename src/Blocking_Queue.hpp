@@ -8,13 +8,19 @@
  */
 
 // C++ Libraries
+#include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <type_traits>
 
 /**
  * @class Blocking_Queue
+ *
+ * @note  MUTEX_TP may be any Lockable, ex: acc::Instrumented_Mutex<> to see how contended
+ *        the queue is.  Anything other than std::mutex waits on std::condition_variable_any.
  */
-template<typename T>
+template<typename T,
+         typename MUTEX_TP = std::mutex>
 class Blocking_Queue
 {
     public:
@@ -145,9 +151,18 @@ class Blocking_Queue
             return m_queue.size();
         }
 
+        const MUTEX_TP& get_mutex() const noexcept
+        {
+            return m_mutex;
+        }
+
     private:
         std::queue<T> m_queue;
-        mutable std::mutex m_mutex;
-        std::condition_variable m_ready;
+        typedef std::conditional_t<std::is_same_v<MUTEX_TP,std::mutex>,
+                                   std::condition_variable,
+                                   std::condition_variable_any> CONDITION_TP;
+
+        mutable MUTEX_TP m_mutex;
+        CONDITION_TP m_ready;
         bool m_done = false;
 };
\ No newline at end of file
@@ -0,0 +1,509 @@
+/**
+ * @file    Task_Graph.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ *
+ * @note  Continuations, when_all / when_any, and a small dependency graph on top of Thread_Pool.
+ *        Nothing in here blocks a worker thread:  a stage is posted to the pool only once
+ *        every input it depends on has completed.
+ */
+#pragma once
+
+// C++ Libraries
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Demo Libraries
+#include "Thread_Pool.hpp"
+
+namespace detail {
+
+/**
+ * @class Task_State
+ *
+ * Shared result of a Task plus the continuations waiting on it.
+*/
+template <typename T>
+class Task_State
+{
+    public:
+
+        Task_State()
+          : m_future( m_promise.get_future().share() )
+        {
+        }
+
+        /**
+         * @brief Run the work, store its result or exception, then release continuations.
+        */
+        template <typename F>
+        void run( F&& work )
+        {
+            try
+            {
+                if constexpr ( std::is_void_v<T> )
+                {
+                    work();
+                    m_promise.set_value();
+                }
+                else
+                {
+                    m_promise.set_value( work() );
+                }
+            }
+            catch(...)
+            {
+                m_promise.set_exception( std::current_exception() );
+            }
+            complete();
+        }
+
+        /**
+         * @brief Register a callback for completion.  Runs inline if already complete.
+        */
+        void on_complete( std::function<void()> continuation )
+        {
+            {
+                std::unique_lock<std::mutex> lck( m_mtx );
+                if( !m_complete )
+                {
+                    m_continuations.push_back( std::move( continuation ) );
+                    return;
+                }
+            }
+            continuation();
+        }
+
+        std::shared_future<T> future() const
+        {
+            return m_future;
+        }
+
+    private:
+
+        void complete()
+        {
+            std::vector<std::function<void()>> continuations;
+            {
+                std::unique_lock<std::mutex> lck( m_mtx );
+                m_complete = true;
+                continuations.swap( m_continuations );
+            }
+            for( auto& continuation : continuations )
+            {
+                continuation();
+            }
+        }
+
+        std::promise<T> m_promise;
+        std::shared_future<T> m_future;
+
+        std::mutex m_mtx;
+        bool m_complete { false };
+        std::vector<std::function<void()>> m_continuations;
+
+}; // End of Task_State Class
+
+} // End of detail namespace
+
+/**
+ * @class Task
+ *
+ * Handle to work running on a Thread_Pool which can be chained with then().
+*/
+template <typename T>
+class Task
+{
+    public:
+
+        typedef T value_type;
+
+        Task() = default;
+
+        Task( Thread_Pool*                            pool,
+              std::shared_ptr<detail::Task_State<T>>  state )
+          : m_pool( pool ),
+            m_state( std::move( state ) )
+        {
+        }
+
+        bool valid() const
+        {
+            return (bool)m_state;
+        }
+
+        /**
+         * @brief Check if the result is available without blocking
+        */
+        bool is_ready() const
+        {
+            return m_state->future().wait_for( std::chrono::seconds(0) ) == std::future_status::ready;
+        }
+
+        /**
+         * @brief Block until the result is ready.  Do not call from a pool worker.
+        */
+        void wait() const
+        {
+            m_state->future().wait();
+        }
+
+        /**
+         * @brief Get the result, rethrowing any exception.  Blocks if not yet ready.
+        */
+        decltype(auto) get() const
+        {
+            return m_state->future().get();
+        }
+
+        std::shared_future<T> future() const
+        {
+            return m_state->future();
+        }
+
+        /**
+         * @brief Schedule a continuation which receives this task's value once it is ready.
+         *
+         * If this task failed, the continuation is skipped and the exception is propagated.
+        */
+        template <typename F>
+        auto then( F&& func, Task_Priority priority = Task_Priority::NORMAL )
+        {
+            typedef typename continuation_result<F>::type R;
+
+            auto child  = std::make_shared<detail::Task_State<R>>();
+            auto parent = m_state->future();
+            auto pool   = m_pool;
+
+            m_state->on_complete( [pool, child, parent, priority, func = std::forward<F>(func)]() mutable {
+                pool->post( [child, parent, func = std::move(func)]() mutable {
+                    child->run( [&]() -> R {
+                        if constexpr ( std::is_void_v<T> )
+                        {
+                            parent.get();
+                            return func();
+                        }
+                        else
+                        {
+                            return func( parent.get() );
+                        }
+                    });
+                }, priority );
+            });
+
+            return Task<R>( m_pool, child );
+        }
+
+        /**
+         * @brief Register a completion callback run on the completing thread.
+         * @note  Keep the callback short; it is not posted to the pool.
+        */
+        void on_complete( std::function<void()> callback ) const
+        {
+            m_state->on_complete( std::move( callback ) );
+        }
+
+        Thread_Pool* pool() const
+        {
+            return m_pool;
+        }
+
+    private:
+
+        template <typename F, typename U = T>
+        struct continuation_result
+        {
+            typedef std::invoke_result_t<F,const U&> type;
+        };
+
+        template <typename F>
+        struct continuation_result<F,void>
+        {
+            typedef std::invoke_result_t<F> type;
+        };
+
+        /// Pool used to run continuations
+        Thread_Pool* m_pool { nullptr };
+
+        /// Shared result
+        std::shared_ptr<detail::Task_State<T>> m_state;
+
+}; // End of Task Class
+
+/**
+ * @brief Launch a function on the pool as the root of a task chain.
+*/
+template <typename F>
+auto spawn( Thread_Pool&   pool,
+            F&&            func,
+            Task_Priority  priority = Task_Priority::NORMAL )
+{
+    typedef std::invoke_result_t<F> R;
+
+    auto state = std::make_shared<detail::Task_State<R>>();
+    pool.post( [state, func = std::forward<F>(func)]() mutable {
+        state->run( func );
+    }, priority );
+
+    return Task<R>( &pool, state );
+}
+
+/**
+ * @brief Create a task which completes once every input has completed.
+ *
+ * The result is a vector of input values in input order (or void for void tasks).
+ * If any input failed, the first failure in input order is rethrown by get().
+*/
+template <typename T>
+auto when_all( Thread_Pool&                  pool,
+               const std::vector<Task<T>>&   tasks,
+               Task_Priority                 priority = Task_Priority::NORMAL )
+{
+    typedef std::conditional_t<std::is_void_v<T>,void,std::vector<T>> R;
+
+    auto state     = std::make_shared<detail::Task_State<R>>();
+    auto remaining = std::make_shared<std::atomic<size_t>>( tasks.size() + 1 );
+
+    std::vector<std::shared_future<T>> futures;
+    futures.reserve( tasks.size() );
+    for( const auto& task : tasks )
+    {
+        futures.push_back( task.future() );
+    }
+
+    auto gather = [state, futures = std::move(futures)]() -> R {
+        if constexpr ( std::is_void_v<T> )
+        {
+            for( const auto& f : futures ){ f.get(); }
+        }
+        else
+        {
+            R values;
+            values.reserve( futures.size() );
+            for( const auto& f : futures ){ values.push_back( f.get() ); }
+            return values;
+        }
+    };
+
+    // The extra count keeps the gather from firing while callbacks are still being registered
+    auto release = [&pool, state, remaining, priority, gather]() {
+        if( remaining->fetch_sub( 1 ) == 1 )
+        {
+            pool.post( [state, gather]() mutable { state->run( gather ); }, priority );
+        }
+    };
+
+    for( const auto& task : tasks )
+    {
+        task.on_complete( release );
+    }
+    release();
+
+    return Task<R>( &pool, state );
+}
+
+/**
+ * @brief Create a task which completes with the index of the first input to complete.
+ * @note  With no inputs the returned task fails with std::invalid_argument.
+*/
+template <typename T>
+Task<size_t> when_any( Thread_Pool&                 pool,
+                       const std::vector<Task<T>>&  tasks )
+{
+    auto state = std::make_shared<detail::Task_State<size_t>>();
+    if( tasks.empty() )
+    {
+        state->run( []() -> size_t { throw std::invalid_argument( "when_any requires at least one task" ); } );
+        return Task<size_t>( &pool, state );
+    }
+
+    auto fired = std::make_shared<std::atomic<bool>>( false );
+
+    for( size_t idx = 0; idx < tasks.size(); idx++ )
+    {
+        tasks[idx].on_complete( [state, fired, idx]() {
+            if( !fired->exchange( true ) )
+            {
+                state->run( [idx]() { return idx; } );
+            }
+        });
+    }
+
+    return Task<size_t>( &pool, state );
+}
+
+/**
+ * @class Task_Graph
+ *
+ * Static dependency graph of void stages.  Each stage is posted as soon as all of its
+ * inputs have finished, so independent stages run in parallel.
+*/
+class Task_Graph
+{
+    public:
+
+        typedef size_t Node_Id;
+
+        explicit Task_Graph( Thread_Pool& pool )
+          : m_pool( pool ),
+            m_state( std::make_shared<Graph_State>() )
+        {
+        }
+
+        /**
+         * @brief Add a stage which runs after every node in dependencies.
+         * @note  Dependencies must already be in the graph, which keeps it acyclic.
+         * @throws std::logic_error if the graph has already been run
+        */
+        Node_Id add( std::function<void()>        work,
+                     const std::vector<Node_Id>&  dependencies = {},
+                     Task_Priority                priority = Task_Priority::NORMAL )
+        {
+            if( m_launched )
+            {
+                throw std::logic_error( "Task_Graph cannot add stages after run()" );
+            }
+            Node_Id id = m_state->nodes.size();
+            auto node = std::make_unique<Node>();
+            node->work       = std::move( work );
+            node->priority   = priority;
+            node->num_inputs = dependencies.size();
+            for( auto dep : dependencies )
+            {
+                if( dep >= id )
+                {
+                    throw std::invalid_argument( "Task_Graph dependency " + std::to_string(dep) + " does not exist" );
+                }
+                m_state->nodes[dep]->successors.push_back( id );
+            }
+            m_state->nodes.push_back( std::move( node ) );
+            return id;
+        }
+
+        size_t size() const
+        {
+            return m_state->nodes.size();
+        }
+
+        /**
+         * @brief Launch every stage.  The returned task completes when all stages have finished.
+         *
+         * If a stage throws, its dependents are skipped and the first exception is rethrown
+         * by the returned task.
+         * @throws std::logic_error if the graph has already been run
+        */
+        Task<void> run()
+        {
+            if( m_launched )
+            {
+                throw std::logic_error( "Task_Graph may only be run once" );
+            }
+            m_launched = true;
+
+            auto state = m_state;
+            state->remaining = state->nodes.size();
+            if( state->nodes.empty() )
+            {
+                state->done->run( [](){} );
+            }
+            for( auto& node : state->nodes )
+            {
+                node->pending = node->num_inputs;
+            }
+            for( Node_Id id = 0; id < state->nodes.size(); id++ )
+            {
+                if( state->nodes[id]->num_inputs == 0 )
+                {
+                    launch( m_pool, state, id );
+                }
+            }
+            return Task<void>( &m_pool, state->done );
+        }
+
+    private:
+
+        struct Node
+        {
+            std::function<void()> work;
+            Task_Priority priority { Task_Priority::NORMAL };
+            size_t num_inputs { 0 };
+            std::atomic<size_t> pending { 0 };
+            std::atomic<bool> skip { false };
+            std::vector<Node_Id> successors;
+        };
+
+        struct Graph_State
+        {
+            std::vector<std::unique_ptr<Node>> nodes;
+            std::atomic<size_t> remaining { 0 };
+
+            std::mutex error_mtx;
+            std::exception_ptr first_error;
+
+            std::shared_ptr<detail::Task_State<void>> done { std::make_shared<detail::Task_State<void>>() };
+        };
+
+        static void launch( Thread_Pool&                  pool,
+                            std::shared_ptr<Graph_State>  state,
+                            Node_Id                       id )
+        {
+            auto priority = state->nodes[id]->priority;
+            pool.post( [&pool, state, id]() {
+                Node& node = *state->nodes[id];
+                if( !node.skip )
+                {
+                    try
+                    {
+                        node.work();
+                    }
+                    catch(...)
+                    {
+                        std::unique_lock<std::mutex> lck( state->error_mtx );
+                        if( !state->first_error )
+                        {
+                            state->first_error = std::current_exception();
+                        }
+                        node.skip = true;
+                    }
+                }
+
+                for( auto succ : node.successors )
+                {
+                    if( node.skip )
+                    {
+                        state->nodes[succ]->skip = true;
+                    }
+                    if( state->nodes[succ]->pending.fetch_sub( 1 ) == 1 )
+                    {
+                        launch( pool, state, succ );
+                    }
+                }
+
+                if( state->remaining.fetch_sub( 1 ) == 1 )
+                {
+                    state->done->run( [state]() {
+                        if( state->first_error )
+                        {
+                            std::rethrow_exception( state->first_error );
+                        }
+                    });
+                }
+            }, priority );
+        }
+
+        Thread_Pool& m_pool;
+
+        std::shared_ptr<Graph_State> m_state;
+
+        /// Set by run(); the graph is frozen from then on
+        bool m_launched { false };
+
+}; // End of Task_Graph Class
@@ -0,0 +1,223 @@
+/**
+ * @file    Task_Scheduler.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ *
+ * @note  Drop-in replacement for the FIFO Blocking_Queue used by Thread_Pool.  Tasks are
+ *        grouped by priority class, ordered earliest-deadline-first within each class, and
+ *        lower classes are guaranteed service after being bypassed too many times.
+ */
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// Project Libraries
+#include <lib-acc/Trace_Context.hpp>
+
+/**
+ * @enum Task_Priority
+ */
+enum class Task_Priority : int
+{
+    HIGH       = 0 /*< Latency-critical work, always served first*/,
+    NORMAL     = 1 /*< Default class for submitted work*/,
+    BACKGROUND = 2 /*< Bulk / batch work*/,
+};
+
+/// Number of priority classes
+constexpr size_t NUM_TASK_PRIORITIES = 3;
+
+/**
+ * @struct Scheduled_Task
+ */
+struct Scheduled_Task
+{
+    typedef std::chrono::steady_clock Clock;
+
+    /// Work to perform
+    std::function<void()> func;
+
+    /// Priority class
+    Task_Priority priority { Task_Priority::NORMAL };
+
+    /// Time the task entered the queue
+    Clock::time_point enqueue_time;
+
+    /// Deadline (time_point::max() if the task has none)
+    Clock::time_point deadline { Clock::time_point::max() };
+
+    /// Tie-breaker to keep FIFO order among equal deadlines
+    uint64_t sequence { 0 };
+
+    /// Submitting thread's trace context, restored on the worker
+    acc::trace::Trace_Context context;
+};
+
+/**
+ * @class Task_Scheduler
+ */
+class Task_Scheduler
+{
+    public:
+
+        /**
+         * @brief Constructor
+         * @param starvation_limit Number of times a non-empty class may be passed over
+         *                         before it is served ahead of higher classes.
+        */
+        explicit Task_Scheduler( size_t starvation_limit = 16 )
+          : m_starvation_limit( std::max<size_t>( starvation_limit, 1 ) )
+        {
+        }
+
+        void push( Scheduled_Task&& task )
+        {
+            {
+                std::unique_lock lock(m_mutex);
+                task.sequence = m_sequence++;
+                auto& heap = m_queues[(int)task.priority];
+                heap.push_back( std::move( task ) );
+                std::push_heap( heap.begin(), heap.end(), Deadline_Order() );
+                m_size++;
+            }
+            m_ready.notify_one();
+        }
+
+        bool pop( Scheduled_Task& task )
+        {
+            std::unique_lock lock(m_mutex);
+            while( m_size == 0 && !m_done )
+                m_ready.wait(lock);
+            if( m_size == 0 )
+                return false;
+            select_and_pop( task );
+            return true;
+        }
+
+        bool try_pop( Scheduled_Task& task )
+        {
+            std::unique_lock lock(m_mutex, std::try_to_lock);
+            if( !lock || m_size == 0 )
+                return false;
+            select_and_pop( task );
+            return true;
+        }
+
+        void done() noexcept
+        {
+            {
+                std::unique_lock lock(m_mutex);
+                m_done = true;
+            }
+            m_ready.notify_all();
+        }
+
+        bool empty() const noexcept
+        {
+            std::scoped_lock lock(m_mutex);
+            return m_size == 0;
+        }
+
+        unsigned int size() const noexcept
+        {
+            std::scoped_lock lock(m_mutex);
+            return m_size;
+        }
+
+        unsigned int size( Task_Priority priority ) const noexcept
+        {
+            std::scoped_lock lock(m_mutex);
+            return m_queues[(int)priority].size();
+        }
+
+    private:
+
+        /**
+         * Heap comparator.  std heaps are max-heaps, so "less" means "later deadline".
+        */
+        struct Deadline_Order
+        {
+            bool operator()( const Scheduled_Task& lhs,
+                             const Scheduled_Task& rhs ) const
+            {
+                if( lhs.deadline != rhs.deadline )
+                {
+                    return lhs.deadline > rhs.deadline;
+                }
+                return lhs.sequence > rhs.sequence;
+            }
+        };
+
+        /**
+         * @brief Choose the class to serve and pop its earliest-deadline task.
+         * @note  Caller must hold m_mutex and the scheduler must be non-empty.
+        */
+        void select_and_pop( Scheduled_Task& task )
+        {
+            // Highest non-empty class wins by default
+            size_t selected = NUM_TASK_PRIORITIES;
+            for( size_t c = 0; c < NUM_TASK_PRIORITIES; c++ )
+            {
+                if( !m_queues[c].empty() )
+                {
+                    selected = c;
+                    break;
+                }
+            }
+
+            // Starvation protection:  promote a lower class that has been bypassed too often
+            for( size_t c = selected + 1; c < NUM_TASK_PRIORITIES; c++ )
+            {
+                if( !m_queues[c].empty() && m_bypass_counts[c] >= m_starvation_limit )
+                {
+                    selected = c;
+                    break;
+                }
+            }
+
+            for( size_t c = 0; c < NUM_TASK_PRIORITIES; c++ )
+            {
+                if( c == selected )
+                {
+                    m_bypass_counts[c] = 0;
+                }
+                else if( !m_queues[c].empty() )
+                {
+                    m_bypass_counts[c]++;
+                }
+            }
+
+            auto& heap = m_queues[selected];
+            std::pop_heap( heap.begin(), heap.end(), Deadline_Order() );
+            task = std::move( heap.back() );
+            heap.pop_back();
+            m_size--;
+        }
+
+        /// One deadline-ordered heap per priority class
+        std::array<std::vector<Scheduled_Task>,NUM_TASK_PRIORITIES> m_queues;
+
+        /// Number of dispatches each waiting class has been passed over for
+        std::array<size_t,NUM_TASK_PRIORITIES> m_bypass_counts {};
+
+        /// Bypass count at which a class is forced to the front
+        size_t m_starvation_limit;
+
+        /// Sequence counter for FIFO tie-breaking
+        uint64_t m_sequence { 0 };
+
+        /// Total tasks queued
+        unsigned int m_size { 0 };
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_ready;
+        bool m_done = false;
+};
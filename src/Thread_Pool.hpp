@@ -8,16 +8,22 @@
 */
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <future>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <thread>
 #include <utility>
 #include <vector>
 
-#include "Blocking_Queue.hpp"
+#include <lib-acc/Accumulator.hpp>
+#include <lib-acc/Arrival_Monitor.hpp>
+
+#include "Task_Scheduler.hpp"
 
 class Thread_Pool
 {
@@ -35,37 +41,89 @@ private:
         {
         }
 
+        // pop() blocks until a task is ready, and returns false once the
+        // scheduler is done and drained
         void operator()()
         {
-            std::function<void()> func;
-            bool dequeued;
-            while (!m_pool->m_shutdown)
+            Scheduled_Task task;
+            while (m_pool->m_queue.pop(task))
+            {
+                run(task);
+            }
+        }
+
+    private:
+        // Execute a task and record its per-class latencies
+        void run(Scheduled_Task &task)
+        {
+            const int cls = (int)task.priority;
+            auto start_time = Scheduled_Task::Clock::now();
+            if (start_time > task.deadline)
+            {
+                m_pool->m_deadline_misses[cls]++;
+            }
+            m_pool->m_queue_latency[cls].insert(Latency_Duration(start_time - task.enqueue_time));
+
+            // Run under the submitter's span, charging it the queue wait
+            acc::trace::Context_Guard trace_guard(task.context);
+            if (task.context.span != nullptr)
             {
-                {
-                    std::unique_lock<std::mutex> lock(m_pool->m_conditional_mutex);
-                    if (m_pool->m_queue.empty())
-                    {
-                        m_pool->m_conditional_lock.wait(lock);
-                    }
-                    dequeued = m_pool->m_queue.pop(func);
-                }
-                if (dequeued)
-                {
-                    func();
-                }
+                task.context.span->record_queue_wait(start_time - task.enqueue_time);
             }
+
+            m_pool->m_active_workers++;
+            task.func();
+            m_pool->m_active_workers--;
+
+            auto end_time = Scheduled_Task::Clock::now();
+            m_pool->m_task_latency[cls].insert(Latency_Duration(end_time - task.enqueue_time));
+            m_pool->m_completions.arrive(end_time);
         }
     };
 
-    std::atomic<bool> m_shutdown;
-    Blocking_Queue<std::function<void()>> m_queue;
+    // Latency accumulators report milliseconds
+    typedef std::chrono::duration<double, std::milli> Latency_Duration;
+    typedef acc::Accumulator<acc::FULL_FEATURE_SET, double> Latency_Accumulator;
+
+    Task_Scheduler m_queue;
     std::vector<std::thread> m_threads;
-    std::mutex m_conditional_mutex;
-    std::condition_variable m_conditional_lock;
+
+    // Per-class time spent waiting in the queue
+    std::array<Latency_Accumulator, NUM_TASK_PRIORITIES> m_queue_latency{Latency_Accumulator::create("ms"),
+                                                                          Latency_Accumulator::create("ms"),
+                                                                          Latency_Accumulator::create("ms")};
+
+    // Per-class time from submission to completion
+    std::array<Latency_Accumulator, NUM_TASK_PRIORITIES> m_task_latency{Latency_Accumulator::create("ms"),
+                                                                         Latency_Accumulator::create("ms"),
+                                                                         Latency_Accumulator::create("ms")};
+
+    // Per-class count of tasks started after their deadline
+    std::array<std::atomic<int64_t>, NUM_TASK_PRIORITIES> m_deadline_misses{};
+
+    // Workers currently running a task
+    std::atomic<int> m_active_workers{0};
+
+    // Gaps between task completions, for spotting hung workers
+    acc::Arrival_Tracker m_completions{"Completions"};
+
+    // Push a task onto the scheduler, which wakes up a worker
+    void enqueue(std::function<void()> func,
+                 Task_Priority priority,
+                 std::optional<std::chrono::steady_clock::time_point> deadline)
+    {
+        Scheduled_Task task;
+        task.func = std::move(func);
+        task.priority = priority;
+        task.enqueue_time = Scheduled_Task::Clock::now();
+        task.deadline = deadline.value_or(Scheduled_Task::Clock::time_point::max());
+        task.context = acc::trace::current_context();
+        m_queue.push(std::move(task));
+    }
 
 public:
-    Thread_Pool(const int n_threads)
-        : m_threads(std::vector<std::thread>(n_threads)), m_shutdown(false)
+    Thread_Pool(const int n_threads, const size_t starvation_limit = 16)
+        : m_queue(starvation_limit), m_threads(std::vector<std::thread>(n_threads))
     {
     }
 
@@ -84,15 +142,13 @@ public:
         }
     }
 
-    // Waits until threads finish their current task and shutdowns the pool
+    // Waits until threads finish the queued tasks and shutdowns the pool
     void shutdown()
     {
-        m_shutdown = true;
         m_queue.done();
 
         for (int i = 0; i < m_threads.size(); ++i)
         {
-            m_conditional_lock.notify_all();
             if (m_threads[i].joinable())
             {
                 m_threads[i].join();
@@ -103,6 +159,17 @@ public:
     // Submit a function to be executed asynchronously by the pool
     template <typename F, typename... Args>
     auto submit(F &&f, Args &&...args) -> std::future<decltype(f(args...))>
+    {
+        return submit_with(Task_Priority::NORMAL, std::nullopt, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    // Submit a function with a priority class and an optional deadline.  Tasks of the
+    // same class run earliest-deadline-first; tasks without a deadline run after those with one.
+    template <typename F, typename... Args>
+    auto submit_with(Task_Priority priority,
+                     std::optional<std::chrono::steady_clock::time_point> deadline,
+                     F &&f,
+                     Args &&...args) -> std::future<decltype(f(args...))>
     {
         // Create a function with bounded parameters ready to execute
         std::function<decltype(f(args...))()> func = std::bind(std::forward<F>(f), std::forward<Args>(args)...);
@@ -116,12 +183,52 @@ public:
         };
 
         // Enqueue generic wrapper function
-        m_queue.push(wrapper_func);
-
-        // Wake up one thread if its waiting
-        m_conditional_lock.notify_one();
+        enqueue(std::move(wrapper_func), priority, deadline);
 
         // Return future from promise
         return task_ptr->get_future();
     }
+
+    // Enqueue a fire-and-forget function.  Used by continuations, which deliver
+    // their results through their own shared state rather than a std::future.
+    void post(std::function<void()> func, Task_Priority priority = Task_Priority::NORMAL)
+    {
+        enqueue(std::move(func), priority, std::nullopt);
+    }
+
+    // Time tasks of a class spent waiting in the queue
+    const Latency_Accumulator &queue_latency(Task_Priority priority) const
+    {
+        return m_queue_latency[(int)priority];
+    }
+
+    // Time tasks of a class took from submission to completion
+    const Latency_Accumulator &task_latency(Task_Priority priority) const
+    {
+        return m_task_latency[(int)priority];
+    }
+
+    // Number of tasks of a class which started after their deadline
+    int64_t deadline_misses(Task_Priority priority) const
+    {
+        return m_deadline_misses[(int)priority];
+    }
+
+    // Number of tasks waiting to run
+    unsigned int queue_size() const
+    {
+        return m_queue.size();
+    }
+
+    // Number of workers running a task right now
+    int active_workers() const
+    {
+        return m_active_workers;
+    }
+
+    // Gaps between task completions.  Watch with an acc::Stall_Watchdog to catch hung workers.
+    const acc::Arrival_Tracker &completions() const
+    {
+        return m_completions;
+    }
 };
\ No newline at end of file
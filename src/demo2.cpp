@@ -17,7 +17,11 @@
 
 // Project Libraries
 #include <lib-acc/Accumulator.hpp>
+#include <lib-acc/Arrival_Monitor.hpp>
+#include <lib-acc/Bivariate_Accumulator.hpp>
+#include <lib-acc/Gauge_Poller.hpp>
 #include <lib-acc/Stopwatch.hpp>
+#include <lib-acc/Trace_Context.hpp>
 
 // OpenCV Libraries
 #include <opencv2/core.hpp>
@@ -25,75 +29,139 @@
 #include <opencv2/imgproc.hpp>
 
 // Demo Libraries
+#include "Task_Graph.hpp"
 #include "Thread_Pool.hpp"
 
 // Boost Libraries
 #include <boost/log/trivial.hpp>
 
+/// Completed images, timestamped, with their raw size in MB
+typedef boost::accumulators::stats<acc::count_stat,
+                                   acc::rate_stat> THROUGHPUT_FEATURE_SET;
+
+/// Full stats for per-image timing, plus which images were slowest
+typedef boost::accumulators::stats<acc::mean_stat,
+                                   acc::min_stat,
+                                   acc::max_stat,
+                                   acc::sum_stat,
+                                   acc::count_stat,
+                                   acc::variance_stat,
+                                   acc::exemplars_stat> TIMING_FEATURE_SET;
+
 /**
- * @brief Very dumb function which creates a random image, writes to disk, then checks the file
- * size to simulate measuring the compression ratio
+ * @struct Image_Job
+ *
+ * State handed from one pipeline stage to the next.  work_time only counts time spent
+ * inside the stages, not time waiting in the pool queue between them.
 */
-void Compress_Imagery( int                                              image_id,
-                       cv::Size                                         img_size,
-                       const std::filesystem::path&                     dest_dir,
-                       acc::Accumulator<acc::FULL_FEATURE_SET,double>&  comp_acc,
-                       const std::string&                               ext )
+struct Image_Job
 {
-    try
-    {
-        // Create dummy image
-        cv::Mat image( img_size, CV_8UC3 );
-
-        const size_t expected_size = img_size.width * img_size.height * 3;
+    int                        image_id;
+    cv::Mat                    image;
+    std::filesystem::path      output_path;
+    size_t                     expected_size;
+    std::chrono::milliseconds  work_time { 0 };
+    std::chrono::milliseconds  encode_time { 0 };
+};
 
-        // Name output path
-        std::string pathname = "image_" + std::to_string(image_id) + ext;
-        std::filesystem::path output_path = dest_dir / std::filesystem::path( pathname );
+/**
+ * @brief Stage 1:  Create a random image
+*/
+Image_Job Generate_Image( int       image_id,
+                          cv::Size  img_size )
+{
+    acc::trace::Trace_Zone zone( "Generate" );
+    acc::Stopwatch<> timer;
+    Image_Job job;
+    job.image_id      = image_id;
+    job.expected_size = img_size.width * img_size.height * 3;
 
-        for( size_t r = 0; r < image.rows; r++ )
-        for( size_t c = 0; c < image.cols; c++ )
-        for( size_t x = 0; x < image.channels(); x++ )
-        {
-            image.at<cv::Vec3b>( r, c )[x] = rand() % 255;
-        }
+    // Create dummy image
+    job.image = cv::Mat( img_size, CV_8UC3 );
+    for( size_t r = 0; r < job.image.rows; r++ )
+    for( size_t c = 0; c < job.image.cols; c++ )
+    for( size_t x = 0; x < job.image.channels(); x++ )
+    {
+        job.image.at<cv::Vec3b>( r, c )[x] = rand() % 255;
+    }
+    job.work_time += timer.stop();
+    return job;
+}
 
-        // Median filtering will help the compression a bit
-        for( int i=0; i<2; i++ )
-        {
-            cv::medianBlur( image, image, 5 );
-        }
+/**
+ * @brief Stage 2:  Median filtering will help the compression a bit
+*/
+Image_Job Blur_Image( Image_Job job )
+{
+    acc::trace::Trace_Zone zone( "Blur" );
+    acc::Stopwatch<> timer;
+    for( int i=0; i<2; i++ )
+    {
+        cv::medianBlur( job.image, job.image, 5 );
+    }
+    job.work_time += timer.stop();
+    return job;
+}
 
-        // Write image
-        std::vector<int> compression_params;
-        if( ext == ".png" )
-        {
-            compression_params.push_back(cv::IMWRITE_PNG_COMPRESSION);
-            compression_params.push_back(9);
-        }
-        else if( ext == ".tif" )
-        {
-            compression_params.push_back(cv::IMWRITE_TIFF_COMPRESSION);
-            compression_params.push_back(5);
-        }
-        cv::imwrite( output_path.c_str(), image, compression_params );
+/**
+ * @brief Stage 3:  Write the image to disk in the requested format
+*/
+Image_Job Encode_Image( Image_Job                     job,
+                        const std::filesystem::path&  dest_dir,
+                        const std::string&            ext )
+{
+    acc::trace::Trace_Zone zone( "Encode" );
+    acc::Stopwatch<> timer;
 
-        // Get the original size
-        double file_ratio = std::filesystem::file_size( output_path ) / (double)expected_size;
-        comp_acc.insert( file_ratio * 100 );
+    // Name output path
+    std::string pathname = "image_" + std::to_string(job.image_id) + ext;
+    job.output_path = dest_dir / std::filesystem::path( pathname );
 
-        // Delete the file
-        std::filesystem::remove( output_path );
+    // Write image
+    std::vector<int> compression_params;
+    if( ext == ".png" )
+    {
+        compression_params.push_back(cv::IMWRITE_PNG_COMPRESSION);
+        compression_params.push_back(9);
     }
-    catch(...)
+    else if( ext == ".tif" )
     {
-        std::cout << "Image " << image_id << "Failed to write" << std::endl;
+        compression_params.push_back(cv::IMWRITE_TIFF_COMPRESSION);
+        compression_params.push_back(5);
     }
+    acc::Stopwatch<> encode_timer;
+    cv::imwrite( job.output_path.c_str(), job.image, compression_params );
+    job.encode_time = encode_timer.stop();
+    job.work_time += timer.stop();
+    return job;
+}
+
+/**
+ * @brief Stage 4:  Check the file size to simulate measuring the compression ratio
+*/
+void Record_Compression( const Image_Job&                                 job,
+                         acc::Accumulator<acc::FULL_FEATURE_SET,double>&  comp_acc,
+                         acc::Accumulator<TIMING_FEATURE_SET,double>&     timing_acc,
+                         acc::Accumulator<THROUGHPUT_FEATURE_SET,double>& throughput_acc,
+                         acc::Bivariate_Accumulator&                      encode_vs_comp )
+{
+    // Get the original size
+    double file_ratio = std::filesystem::file_size( job.output_path ) / (double)job.expected_size;
+    comp_acc.insert( file_ratio * 100 );
+
+    // Delete the file
+    std::filesystem::remove( job.output_path );
+
+    timing_acc.insert( job.work_time.count(), acc::Exemplar_Context( (uint64_t)job.image_id ) );
+    encode_vs_comp.insert( job.encode_time.count(), file_ratio * 100 );
+    throughput_acc.insert( job.expected_size / 1e6, std::chrono::steady_clock::now() );
 }
 
 bool okay_to_run = true;
-void Check_Acc_Status( const acc::Accumulator<acc::FULL_FEATURE_SET, double>& timing_acc,
+void Check_Acc_Status( const acc::Accumulator<TIMING_FEATURE_SET, double>&     timing_acc,
                        const acc::Accumulator<acc::FULL_FEATURE_SET, double>& compression_acc,
+                       const acc::Accumulator<THROUGHPUT_FEATURE_SET, double>& throughput_acc,
+                       const acc::Bivariate_Accumulator&                      encode_vs_comp,
                        bool                                                   single_loop,
                        const std::string&                                     format  )
 {
@@ -104,6 +172,17 @@ void Check_Acc_Status( const acc::Accumulator<acc::FULL_FEATURE_SET, double>& ti
                                 << timing_acc.toLogString<>( ) << std::endl;
         BOOST_LOG_TRIVIAL(info) << "Compression Accumulator: \"" << format << "\"" << std::endl
                                 << compression_acc.toLogString<>() << std::endl;
+        BOOST_LOG_TRIVIAL(info) << "Encode Time vs Compression: \"" << format << "\"" << std::endl
+                                << encode_vs_comp.toLogString<>() << std::endl;
+        if( auto rate = throughput_acc.get_rate(); rate && rate.value().count > 1 )
+        {
+            BOOST_LOG_TRIVIAL(info) << "Throughput: \"" << format << "\"" << std::endl
+                                    << acc::print::pretty::Printer::to_log_string( "Images", rate.value().windowed_event_rate, "/s", 4 )
+                                    << acc::print::pretty::Printer::to_log_string( "Raw Data", rate.value().windowed_value_rate, "MB/s", 4 )
+                                    << acc::print::pretty::Printer::to_log_string( "Overall Images", rate.value().event_rate, "/s", 4 )
+                                    << acc::print::pretty::Printer::to_log_string( "Overall Raw Data", rate.value().value_rate, "MB/s", 4 )
+                                    << std::endl;
+        }
         std::this_thread::sleep_for( std::chrono::seconds( 20 ) );
 
         if( single_loop )
@@ -131,11 +210,17 @@ void Test_Compression_Format( const std::string& format,
     }
 
     // Build the two Accumulators
-    auto timing_acc      = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+    auto timing_acc      = acc::Accumulator<TIMING_FEATURE_SET,double>::create_with_params( "ms", acc::exemplar_count = 3 );
     auto compression_acc = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "%" );
+    auto throughput_acc  = acc::Accumulator<THROUGHPUT_FEATURE_SET,double>::create_with_params( "MB", acc::rate_window = 5.0 );
+
+    // Do slow encodes go with poor compression?
+    auto encode_vs_comp = acc::Bivariate_Accumulator::create( "ms", "%" );
 
     std::thread status_thread( Check_Acc_Status, std::ref(timing_acc),
                                                  std::ref(compression_acc),
+                                                 std::ref(throughput_acc),
+                                                 std::ref(encode_vs_comp),
                                                  false,
                                                  std::ref(format) );
 
@@ -144,24 +229,61 @@ void Test_Compression_Format( const std::string& format,
         Thread_Pool pool( number_threads );
         pool.init();
 
-        std::deque<std::future<void>> jobs;
+        // Is the pool starved or backed up?
+        acc::Gauge_Poller poller( std::chrono::milliseconds( 10 ) );
+        poller.add_gauge( "Queue Depth", "tasks", [&pool](){ return (double)pool.queue_size(); } );
+        poller.add_gauge( "Active Workers", "threads", [&pool](){ return (double)pool.active_workers(); } );
+        poller.start();
+
+        // Nothing finishing for a few seconds while work is queued means a worker is stuck
+        acc::Stall_Watchdog watchdog( std::chrono::milliseconds( 250 ) );
+        watchdog.watch( pool.completions(),
+                        std::chrono::seconds( 5 ),
+                        [&pool]( const std::string& name, std::chrono::nanoseconds silent )
+                        {
+                            BOOST_LOG_TRIVIAL(warning) << "No " << name << " for "
+                                                       << std::chrono::duration<double>( silent ).count() << " s, "
+                                                       << pool.queue_size() << " queued, "
+                                                       << pool.active_workers() << " workers busy";
+                        } );
+        watchdog.start();
+
+        // Stages run under this span wherever the pool puts them, so the batch gets a
+        // per-stage breakdown plus the time its tasks sat in the queue
+        acc::trace::Trace_Span batch( format + " Batch" );
+
+        // Each image is a chain of stages.  A stage is queued as soon as the previous one
+        // finishes, so workers never sit blocked waiting on a future.
+        std::vector<Task<void>> jobs;
+        jobs.reserve( number_images );
         for( size_t worker = 0; worker < number_images; worker++ )
         {
-            jobs.push_back( pool.submit([=, &timing_acc, &compression_acc, &format ]() {
-                int id = worker;
-
-                acc::Stopwatch<> timer;
-                Compress_Imagery( id,
-                                  image_size,
-                                  output_dir,
-                                  compression_acc,
-                                  format );
-                timing_acc.insert( (double)timer.stop().count() );
-            }));
+            int id = worker;
+            jobs.push_back( spawn( pool, [=]() { return Generate_Image( id, image_size ); } )
+                .then( []( const Image_Job& job ) { return Blur_Image( job ); } )
+                .then( [&]( const Image_Job& job ) { return Encode_Image( job, output_dir, format ); } )
+                .then( [&]( const Image_Job& job ) { Record_Compression( job, compression_acc, timing_acc, throughput_acc, encode_vs_comp ); } ) );
         }
 
         std::cout << "Waiting for " << format << " jobs to finish" << std::endl;
-        for( auto& job : jobs ){ job.get(); }
+        when_all( pool, jobs ).wait();
+        for( size_t id = 0; id < jobs.size(); id++ )
+        {
+            try
+            {
+                jobs[id].get();
+            }
+            catch(...)
+            {
+                std::cout << "Image " << id << "Failed to write" << std::endl;
+            }
+        }
+
+        poller.stop();
+        watchdog.stop();
+        BOOST_LOG_TRIVIAL(info) << format << " pool occupancy:\n" << poller.toLogString();
+        BOOST_LOG_TRIVIAL(info) << format << " task completions:\n" << pool.completions().toLogString();
+        BOOST_LOG_TRIVIAL(info) << format << " batch breakdown:\n" << batch.toLogString();
 
         std::cout << "Shutting down thread pool" << std::endl;
         pool.shutdown();
@@ -177,6 +299,8 @@ void Test_Compression_Format( const std::string& format,
     // Final printout
     Check_Acc_Status( timing_acc,
                       compression_acc,
+                      throughput_acc,
+                      encode_vs_comp,
                       true,
                       format );
 }
@@ -13,9 +13,18 @@
 #include <iostream>
 #include <map>
 #include <thread>
+#include <vector>
 
 // Project Libraries
 #include <lib-acc/Accumulator.hpp>
+#define ACC_DEFINE_ALLOC_HOOKS
+#include <lib-acc/Alloc_Profiler.hpp>
+#include <lib-acc/Complexity_Estimator.hpp>
+#include <lib-acc/Heavy_Hitters.hpp>
+#include <lib-acc/Instrumented_Mutex.hpp>
+#include <lib-acc/Perf_Counters.hpp>
+#include <lib-acc/Resource_Sampler.hpp>
+#include <lib-acc/Split_Stopwatch.hpp>
 #include <lib-acc/Stopwatch.hpp>
 
 // Boost Libraries
@@ -72,7 +81,7 @@ class ReallyComicallyBadAddressBook
                      const std::string& name )
         {
             Contact ref_contact( phone_number, name );
-            std::unique_lock<std::mutex> lck( m_mtx );
+            std::unique_lock lck( m_mtx );
             auto it = std::find( m_phone_numbers.begin(),
                                  m_phone_numbers.end(),
                                  ref_contact );
@@ -92,12 +101,17 @@ class ReallyComicallyBadAddressBook
             return m_phone_numbers.size();
         }
 
+        const acc::Instrumented_Mutex<>& mutex() const
+        {
+            return m_mtx;
+        }
+
         std::string print() const
         {
             std::stringstream sout;
             sout << "Address Book" << std::endl;
             sout << "------------" << std::endl;
-            std::unique_lock<std::mutex> lck( m_mtx );
+            std::unique_lock lck( m_mtx );
             for( const auto& contact : m_phone_numbers )
             {
                 sout << contact.print() << std::endl;
@@ -109,7 +123,7 @@ class ReallyComicallyBadAddressBook
         //std::vector<Contact> m_phone_numbers;
         std::deque<Contact> m_phone_numbers;
 
-        mutable std::mutex m_mtx;
+        mutable acc::Instrumented_Mutex<> m_mtx;
 };
 
 /**
@@ -149,32 +163,99 @@ int main( int argc, char* argv[] )
 
     auto timing_acc = acc::Accumulator<acc::ALL_FEATURE_SET, double>::create_rolling( "ms", window_size );
 
+    // Flag the slowdown automatically instead of waiting for someone to read the plots
+    typedef boost::accumulators::stats<acc::count_stat,
+                                       acc::mean_stat,
+                                       acc::cusum_stat,
+                                       acc::page_hinkley_stat> REGRESSION_FEATURE_SET;
+    auto regression_acc = acc::Accumulator<REGRESSION_FEATURE_SET, double, void, acc::Instrumented_Mutex<>>::create_with_params( "ms",
+        acc::change_point_callback = acc::Change_Point_Callback( []( const acc::Change_Point_Event& event ){
+            BOOST_LOG_TRIVIAL(warning) << event.detector << " detected " << acc::to_string( event.type )
+                                       << " at insert " << event.sample_index << " (baseline "
+                                       << event.reference_mean << " +/- " << event.reference_stddev
+                                       << " ms, sample " << event.value << " ms)";
+        } ) );
+
+    // Insert cost vs address book size, fit as cost ~ a * n^k
+    auto complexity = acc::Complexity_Estimator::create( "ms" );
+
+    // Generated numbers vs distinct numbers, to see how often the retry loop spins
+    typedef boost::accumulators::stats<acc::count_stat,
+                                       acc::distinct_count_stat> ATTEMPT_FEATURE_SET;
+    auto attempt_acc = acc::Accumulator<ATTEMPT_FEATURE_SET, double>::create_with_params( "" );
+
+    // Which area codes account for the most insert time
+    auto area_code_cost = acc::Heavy_Hitters<std::string>::create( 10, "ms", acc::Heavy_Hitter_Rank::TOTAL );
+
+    // Cache misses and descheduling inside the insert
+    auto insert_region = acc::perf::Perf_Region<>::create( "Insert" );
+
+    // Waiting on the address book lock vs working inside it
+    auto insert_split = acc::Split_Timing_Accumulator<>::create( "ms" );
+
+    // Heap traffic from building the phone number and name strings, summed over retries
+    auto generate_allocs = acc::alloc::Alloc_Region<>::create( "Generate" );
+
+    // Memory growth and scheduling pressure over the run
+    acc::proc::Resource_Sampler<> resource_sampler( std::chrono::milliseconds( 250 ) );
+    resource_sampler.start();
+
     std::vector<std::thread> threads;
 
     for( size_t i=0; i<num_threads; i++ )
     {
-        threads.push_back( std::thread( [&address_book, &timing_acc,&log_interval](){
+        threads.push_back( std::thread( [&address_book, &timing_acc, &regression_acc, &complexity, &area_code_cost, &attempt_acc, &insert_region, &insert_split, &generate_allocs, &log_interval](){
             size_t loops = 0;
             std::string phone_number;
             std::string contact;
+
+            // Numbers generated in one pass, fed to attempt_acc once the timers stop
+            std::vector<std::string> attempts;
             while( address_book.size() < max_entries )
             {
-                auto stopwatch = acc::Stopwatch<>();
-
-                while( true )
+                attempts.clear();
+                int64_t         elapsed;
+                acc::Split_Time split;
+                const auto alloc_begin = acc::alloc::thread_reading();
                 {
-                    // Create a randomly generated phone number
-                    phone_number = Generate_Phone_Number();
-                    contact      = Generate_Name();
+                    // Counters open before and close after the stopwatches, so their reads
+                    // and the region's inserts stay out of the timings
+                    acc::perf::Perf_Scope<> perf_scope( insert_region );
+                    auto stopwatch = acc::Stopwatch<>();
+                    acc::Split_Stopwatch split_stopwatch;
 
-                    if( address_book.insert( phone_number,
-                                             contact ) )
+                    while( true )
                     {
-                        break;
+                        // Create a randomly generated phone number.  Only count its
+                        // allocations here, they are recorded once the timers stop.
+                        {
+                            acc::alloc::Alloc_Counting counting;
+                            phone_number = Generate_Phone_Number();
+                            contact      = Generate_Name();
+                        }
+                        attempts.push_back( phone_number );
+
+                        if( address_book.insert( phone_number,
+                                                 contact ) )
+                        {
+                            break;
+                        }
                     }
+
+                    elapsed = stopwatch.stop().count();
+                    split   = split_stopwatch.stop();
                 }
 
-                timing_acc.insert( stopwatch.stop().count() );
+                generate_allocs.record( alloc_begin, acc::alloc::thread_reading() );
+                for( const auto& attempt : attempts )
+                {
+                    attempt_acc.insert_with_key( 1, attempt );
+                }
+                insert_split.insert( split );
+                timing_acc.insert( elapsed );
+                regression_acc.insert( elapsed );
+                complexity.insert( address_book.size(), elapsed );
+                area_code_cost.insert( phone_number.substr( 0, 3 ), elapsed );
 
                 if( loops++ % log_interval == 0 )
                 {
@@ -193,6 +274,24 @@ int main( int argc, char* argv[] )
         }
     }
 
+    resource_sampler.stop();
+
+    BOOST_LOG_TRIVIAL(info) << "Insert cost scaling:\n" << complexity.toLogString();
+    if( complexity.exceeds_exponent( 1.5 ) )
+    {
+        BOOST_LOG_TRIVIAL(warning) << "Insert cost grows faster than n^1.5";
+    }
+    BOOST_LOG_TRIVIAL(info) << "Insert wall vs CPU time:\n" << insert_split.toLogString();
+    BOOST_LOG_TRIVIAL(info) << "Address book lock:\n" << address_book.mutex().toLogString();
+    BOOST_LOG_TRIVIAL(info) << "Regression accumulator lock:\n" << regression_acc.get_mutex().toLogString();
+    BOOST_LOG_TRIVIAL(info) << "Insert counters:\n" << insert_region.toLogString();
+    BOOST_LOG_TRIVIAL(info) << "Generator allocations:\n" << generate_allocs.toLogString();
+    BOOST_LOG_TRIVIAL(info) << "Process resources:\n" << resource_sampler.toLogString();
+    BOOST_LOG_TRIVIAL(info) << "Generated " << attempt_acc.get_count().value() << " numbers, ~"
+                            << std::llround( attempt_acc.get_distinct_count().value() ) << " distinct";
+    BOOST_LOG_TRIVIAL(info) << "Most expensive area codes:\n" << area_code_cost.toLogString( 5 );
+    BOOST_LOG_TRIVIAL(info) << "Change points detected: CUSUM=" << regression_acc.get_cusum().value().detections
+                            << ", Page-Hinkley=" << regression_acc.get_page_hinkley().value().detections;
     BOOST_LOG_TRIVIAL(info) << "End of Program";
     return 0;
 }
\ No newline at end of file
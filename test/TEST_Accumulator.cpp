@@ -73,4 +73,28 @@ TEST( Accumulator, Rolling_Test_01 )
     std::cout << acc.toLogString() << std::endl;
     ASSERT_EQ( acc.get_count().value(), NUM_ITERATIONS );
     //ASSERT_LE( std::fabs( acc.mean() - AVG_SLEEP_TIME_MS ), SLEEP_TIME_RANGE_MS );
-}
\ No newline at end of file
+}
+
+/********************************************/
+/*          Test weighted inserts           */
+/********************************************/
+TEST( Accumulator, Weighted_Test_01 )
+{
+    auto acc = acc::Accumulator<acc::FULL_FEATURE_SET,double,double>::create( "ms" );
+
+    // Weight 3 on the value 3 is the same as inserting it three times
+    acc.insert( 1.0, 1.0 );
+    acc.insert( 3.0, 3.0 );
+
+    ASSERT_EQ( acc.get_count().value(), 2 );
+    ASSERT_NEAR( acc.get_mean().value(), 2.5, 1e-12 );
+    ASSERT_NEAR( acc.get_sum().value(), 10.0, 1e-12 );
+    ASSERT_NEAR( acc.get_variance().value(), 0.75, 1e-12 );
+    ASSERT_EQ( acc.get_min().value(), 1.0 );
+    ASSERT_EQ( acc.get_max().value(), 3.0 );
+
+    // Unweighted inserts count as weight 1
+    acc.insert( 2.5 );
+    ASSERT_NEAR( acc.get_mean().value(), 12.5 / 5, 1e-12 );
+    ASSERT_FALSE( acc.toLogString().empty() );
+}
@@ -0,0 +1,121 @@
+/**
+ * @file    TEST_Accumulator_Array.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Project Libraries
+#include <lib-acc/Accumulator_Array.hpp>
+
+/*************************************************************/
+/*          Entries are independent of each other            */
+/*************************************************************/
+TEST( Accumulator_Array, Entries )
+{
+    auto acc = acc::Accumulator_Array<double>::create( 1000, "ms", 16 );
+    ASSERT_EQ( acc.size(), 1000 );
+    ASSERT_FALSE( acc.get_mean( 5 ) );
+
+    acc.insert( 5, 1 );
+    acc.insert( 5, 3 );
+    acc.insert( 999, -2 );
+
+    auto entry = acc.get_summary( 5 );
+    ASSERT_EQ( entry.count, 2 );
+    ASSERT_DOUBLE_EQ( entry.mean().value(), 2 );
+    ASSERT_DOUBLE_EQ( entry.variance().value(), 1 );
+    ASSERT_DOUBLE_EQ( entry.min, 1 );
+    ASSERT_DOUBLE_EQ( entry.max, 3 );
+    ASSERT_DOUBLE_EQ( acc.get_mean( 999 ).value(), -2 );
+
+    ASSERT_THROW( acc.insert( 1000, 1 ), std::out_of_range );
+}
+
+/*************************************************************/
+/*          Totals and report scan every stripe              */
+/*************************************************************/
+TEST( Accumulator_Array, Total )
+{
+    // Size is not a multiple of the stripe count
+    auto acc = acc::Accumulator_Array<int>::create( 1003, "B", 10 );
+    for( size_t id = 0; id < acc.size(); id += 2 )
+    {
+        acc.insert( id, (int)id );
+    }
+
+    auto total = acc.get_total();
+    ASSERT_EQ( total.count, 502 );
+    ASSERT_DOUBLE_EQ( total.sum, 502.0 * 501 );
+    ASSERT_DOUBLE_EQ( total.min, 0 );
+    ASSERT_DOUBLE_EQ( total.max, 1002 );
+    ASSERT_EQ( acc.get_active_count(), 502 );
+    ASSERT_NE( acc.toLogString().find( "Active Entries" ), std::string::npos );
+}
+
+/*************************************************************/
+/*          Scan lanes and leftovers all reach the total     */
+/*************************************************************/
+TEST( Accumulator_Array, Scan_Lanes )
+{
+    // One stripe of 21 ids:  two full blocks of lanes and 5 leftovers
+    auto acc = acc::Accumulator_Array<double>::create( 21, "ms", 1 );
+    acc.insert( 3, 50 );
+    acc.insert( 20, -4 );
+    acc.insert( 11, 1 );
+    acc.insert( 11, 2 );
+
+    auto total = acc.get_total();
+    ASSERT_EQ( total.count, 4 );
+    ASSERT_DOUBLE_EQ( total.sum, 49 );
+    ASSERT_DOUBLE_EQ( total.sum_squares, 2521 );
+    ASSERT_DOUBLE_EQ( total.min, -4 );
+    ASSERT_DOUBLE_EQ( total.max, 50 );
+}
+
+/*************************************************************/
+/*          Concurrent writers and merge                     */
+/*************************************************************/
+TEST( Accumulator_Array, Threads_And_Merge )
+{
+    auto first  = acc::Accumulator_Array<double>::create( 4096, "ms" );
+    auto second = acc::Accumulator_Array<double>::create( 4096, "ms" );
+
+    std::vector<std::thread> workers;
+    for( int t = 0; t < 4; t++ )
+    {
+        workers.emplace_back( [&first, t](){
+            for( size_t i = 0; i < 40960; i++ )
+            {
+                first.insert( ( i * 7 + t ) % 4096, 1 );
+            }
+        });
+    }
+    for( auto& worker : workers )
+    {
+        worker.join();
+    }
+    ASSERT_EQ( first.get_total().count, 4 * 40960 );
+
+    second.insert( 0, 100 );
+    second.merge( first );
+    ASSERT_EQ( second.get_total().count, 4 * 40960 + 1 );
+    ASSERT_DOUBLE_EQ( second.get_summary( 0 ).max, 100 );
+
+    auto other_size = acc::Accumulator_Array<double>::create( 10, "ms" );
+    ASSERT_THROW( second.merge( other_size ), std::invalid_argument );
+}
+
+/*************************************************************/
+/*          A million entries stay in tens of MB             */
+/*************************************************************/
+TEST( Accumulator_Array, Footprint )
+{
+    auto acc = acc::Accumulator_Array<double>::create( 1000000, "ms" );
+    ASSERT_LT( acc.memory_footprint(), 50 * 1024 * 1024 );
+}
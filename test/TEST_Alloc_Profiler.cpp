@@ -0,0 +1,116 @@
+/**
+ * @file    TEST_Alloc_Profiler.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <memory>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#define ACC_DEFINE_ALLOC_HOOKS
+#include <lib-acc/Alloc_Profiler.hpp>
+
+/**
+ * @brief Keep the compiler from eliding a new/delete pair, like benchmark::DoNotOptimize
+*/
+static void do_not_optimize( const void* ptr )
+{
+    asm volatile( "" : : "g"( ptr ) : "memory" );
+}
+
+/*************************************************************/
+/*          Nothing is counted outside a scope               */
+/*************************************************************/
+TEST( Alloc_Profiler, Outside_Scope )
+{
+    auto begin = acc::alloc::thread_reading();
+    auto data  = std::make_unique<std::vector<int>>( 1000 );
+    data.reset();
+    auto end = acc::alloc::thread_reading();
+
+    ASSERT_EQ( end.allocations, begin.allocations );
+    ASSERT_EQ( end.frees, begin.frees );
+    ASSERT_EQ( end.bytes, begin.bytes );
+}
+
+/*************************************************************/
+/*          A scope records what it allocated                */
+/*************************************************************/
+TEST( Alloc_Profiler, Scope )
+{
+    auto region = acc::alloc::Alloc_Region<>::create( "Test" );
+
+    for( int pass = 0; pass < 3; pass++ )
+    {
+        acc::alloc::Alloc_Scope<> scope( region );
+        auto values = new std::vector<double>( 100 );
+        do_not_optimize( values->data() );
+        delete values;
+    }
+
+    // The vector object and its buffer
+    ASSERT_EQ( region.get_allocations().get_count().value(), 3 );
+    ASSERT_EQ( region.get_allocations().get_mean().value(), 2 );
+    ASSERT_EQ( region.get_frees().get_mean().value(), 2 );
+    ASSERT_EQ( region.get_bytes().get_mean().value(), sizeof(std::vector<double>) + 100 * sizeof(double) );
+    ASSERT_EQ( region.get_alloc_latency().get_count().value(), 3 );
+    ASSERT_NE( region.toLogString().find( "Test Bytes Mean" ), std::string::npos );
+}
+
+/*************************************************************/
+/*          Nested scopes both see the inner allocations     */
+/*************************************************************/
+TEST( Alloc_Profiler, Nested )
+{
+    auto outer = acc::alloc::Alloc_Region<>::create( "Outer" );
+    auto inner = acc::alloc::Alloc_Region<>::create( "Inner" );
+
+    {
+        acc::alloc::Alloc_Scope<> outer_scope( outer );
+        std::unique_ptr<int> first( new int( 1 ) );
+        {
+            acc::alloc::Alloc_Scope<> inner_scope( inner );
+            std::unique_ptr<int> second( new int( 2 ) );
+            do_not_optimize( first.get() );
+            do_not_optimize( second.get() );
+        }
+    }
+
+    ASSERT_EQ( inner.get_allocations().get_sum().value(), 1 );
+    ASSERT_EQ( outer.get_allocations().get_sum().value(), 2 );
+    ASSERT_EQ( outer.get_frees().get_sum().value(), 2 );
+}
+
+/*************************************************************/
+/*          Counting without a scope, recorded later         */
+/*************************************************************/
+TEST( Alloc_Profiler, Counting )
+{
+    auto region = acc::alloc::Alloc_Region<>::create( "Deferred" );
+
+    auto begin = acc::alloc::thread_reading();
+    for( int pass = 0; pass < 3; pass++ )
+    {
+        {
+            acc::alloc::Alloc_Counting counting;
+            std::unique_ptr<int> value( new int( pass ) );
+            do_not_optimize( value.get() );
+        }
+
+        // Not counted between the guarded blocks
+        std::unique_ptr<int> skipped( new int( pass ) );
+        do_not_optimize( skipped.get() );
+    }
+    auto end = acc::alloc::thread_reading();
+    ASSERT_EQ( region.get_allocations().get_count().value(), 0 );
+
+    region.record( begin, end );
+    ASSERT_EQ( region.get_allocations().get_count().value(), 1 );
+    ASSERT_EQ( region.get_allocations().get_sum().value(), 3 );
+    ASSERT_EQ( region.get_frees().get_sum().value(), 3 );
+    ASSERT_EQ( region.get_bytes().get_sum().value(), 3 * sizeof(int) );
+}
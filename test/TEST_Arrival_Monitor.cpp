@@ -0,0 +1,147 @@
+/**
+ * @file    TEST_Arrival_Monitor.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+// Project Libraries
+#include <lib-acc/Arrival_Monitor.hpp>
+
+using namespace std::chrono_literals;
+
+/*************************************************************/
+/*          Gaps go into the stats and the histogram         */
+/*************************************************************/
+TEST( Arrival_Monitor, Tracker_Gaps )
+{
+    acc::Arrival_Tracker tracker( "Jobs" );
+    ASSERT_FALSE( tracker.last_arrival() );
+
+    const auto t0 = acc::Arrival_Tracker::CLOCK_TP::now();
+    tracker.arrive( t0 );
+    tracker.arrive( t0 + 500ns );
+    tracker.arrive( t0 + 500ns + 3ms );
+    tracker.arrive( t0 + 500ns + 4ms );
+
+    ASSERT_EQ( tracker.get_arrivals(), 4 );
+    ASSERT_EQ( tracker.last_arrival().value(), t0 + 500ns + 4ms );
+    ASSERT_EQ( tracker.get_gaps().get_count(), 3 );
+    ASSERT_NEAR( tracker.get_gaps().get_max().value().count(), 3, 1e-9 );
+    ASSERT_NEAR( tracker.get_gaps().get_mean().value().count(), 4.0005 / 3, 1e-9 );
+
+    // 0.5 us -> bucket 0, 1000 us -> [512,1024), 3000 us -> [2048,4096)
+    auto histogram = tracker.get_histogram();
+    ASSERT_EQ( histogram[0], 1 );
+    ASSERT_EQ( histogram[10], 1 );
+    ASSERT_EQ( histogram[12], 1 );
+    ASSERT_EQ( acc::Arrival_Tracker::bucket_upper_bound_us( 10 ), 1024 );
+
+    // Out-of-order clock reads count as zero gaps, and huge gaps land in the last bucket
+    tracker.arrive( t0 );
+    tracker.arrive( t0 + 24h );
+    histogram = tracker.get_histogram();
+    ASSERT_EQ( histogram[0], 2 );
+    ASSERT_EQ( histogram[acc::Arrival_Tracker::NUM_BUCKETS - 1], 1 );
+
+    auto log = tracker.toLogString();
+    ASSERT_NE( log.find( "Jobs Gap Max" ), std::string::npos );
+    ASSERT_NE( log.find( "Jobs Gap <1024 us" ), std::string::npos );
+}
+
+/*************************************************************/
+/*          Accumulator inserts are timestamped              */
+/*************************************************************/
+TEST( Arrival_Monitor, Accumulator )
+{
+    typedef boost::accumulators::stats<acc::count_stat,
+                                       acc::mean_stat,
+                                       acc::rate_stat> ARRIVAL_TEST_SET;
+
+    auto arrivals = acc::Arrival_Accumulator<ARRIVAL_TEST_SET>::create( "Frames", "MB", acc::rate_window = 0.1 );
+    for( int i = 0; i < 5; i++ )
+    {
+        arrivals.insert( 2.0 );
+        std::this_thread::sleep_for( 2ms );
+    }
+
+    ASSERT_EQ( arrivals.get_accumulator().get_count().value(), 5 );
+    ASSERT_EQ( arrivals.get_tracker().get_arrivals(), 5 );
+    ASSERT_GE( arrivals.get_tracker().get_gaps().get_min().value().count(), 2 );
+
+    // The rate feature saw the same timestamps
+    ASSERT_EQ( arrivals.get_accumulator().get_rate().value().count, 5 );
+    ASSERT_NEAR( arrivals.get_accumulator().get_rate().value().span,
+                 arrivals.get_tracker().get_gaps().get_sum().count() / 1000,
+                 1e-9 );
+    ASSERT_NE( arrivals.toLogString().find( "Frames Gap Mean" ), std::string::npos );
+}
+
+/*************************************************************/
+/*          Watchdog fires once per stall and re-arms        */
+/*************************************************************/
+TEST( Arrival_Monitor, Watchdog_Check )
+{
+    acc::Arrival_Tracker tracker( "Worker" );
+    acc::Stall_Watchdog watchdog;
+
+    std::string last_name;
+    std::chrono::nanoseconds last_silent { 0 };
+    int fired = 0;
+    watchdog.watch( tracker, 1s, [&]( const std::string& name, std::chrono::nanoseconds silent )
+    {
+        last_name   = name;
+        last_silent = silent;
+        fired++;
+    } );
+
+    // Never arrived:  timed from the watch call
+    const auto t0 = acc::Stall_Watchdog::CLOCK_TP::now();
+    watchdog.check( t0 + 500ms );
+    ASSERT_EQ( fired, 0 );
+    watchdog.check( t0 + 2s );
+    ASSERT_EQ( fired, 1 );
+    ASSERT_EQ( last_name, "Worker" );
+
+    tracker.arrive( t0 + 3s );
+    watchdog.check( t0 + 3500ms );
+    ASSERT_EQ( fired, 1 );
+    watchdog.check( t0 + 4500ms );
+    ASSERT_EQ( fired, 2 );
+    ASSERT_EQ( last_silent, 1500ms );
+
+    // Same stall is not reported again
+    watchdog.check( t0 + 10s );
+    ASSERT_EQ( fired, 2 );
+    ASSERT_EQ( watchdog.stall_count(), 2 );
+}
+
+/*************************************************************/
+/*          Background thread catches a stalled stream       */
+/*************************************************************/
+TEST( Arrival_Monitor, Watchdog_Thread )
+{
+    acc::Arrival_Tracker tracker;
+    std::atomic<int> fired { 0 };
+
+    acc::Stall_Watchdog watchdog( 5ms );
+    watchdog.watch( tracker, 50ms, [&]( const std::string&, std::chrono::nanoseconds ){ fired++; } );
+    watchdog.start();
+
+    for( int i = 0; i < 10; i++ )
+    {
+        tracker.arrive();
+        std::this_thread::sleep_for( 5ms );
+    }
+    ASSERT_EQ( fired, 0 );
+
+    std::this_thread::sleep_for( 200ms );
+    watchdog.stop();
+    ASSERT_EQ( fired, 1 );
+}
@@ -0,0 +1,180 @@
+/**
+ * @file    TEST_Async_Ingestor.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <thread>
+#include <vector>
+
+// Project Libraries
+#include <lib-acc/Async_Ingestor.hpp>
+#include <lib-acc/Instrumented_Mutex.hpp>
+
+/**************************************************/
+/*          Test the SPSC ring wrap-around        */
+/**************************************************/
+TEST( SPSC_Ring, Wrap_Around )
+{
+    acc::SPSC_Ring<int> ring( 5 );
+    ASSERT_EQ( ring.capacity(), 8 );
+
+    int next_expected = 0;
+    int next_value    = 0;
+    for( int pass = 0; pass < 10; pass++ )
+    {
+        while( ring.try_push( next_value ) ){ next_value++; }
+        ASSERT_EQ( ring.size(), 8 );
+
+        ring.consume( [&]( const int* values, size_t count ) {
+            for( size_t i = 0; i < count; i++ )
+            {
+                ASSERT_EQ( values[i], next_expected++ );
+            }
+        }, 5 );
+        ASSERT_EQ( ring.size(), 3 );
+    }
+}
+
+/**********************************************************/
+/*          Test that every producer's samples land       */
+/**********************************************************/
+TEST( Async_Ingestor, Multiple_Producers )
+{
+    auto acc = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+
+    const int NUM_THREADS = 4;
+    const int NUM_SAMPLES = 50000;
+
+    acc::Async_Ingestor<double> ingestor( 1024, acc::Overflow_Policy::BLOCK );
+    ingestor.start();
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < NUM_THREADS; t++ )
+    {
+        threads.emplace_back( [&](){
+            auto producer = ingestor.create_producer( acc );
+            for( int i = 0; i < NUM_SAMPLES; i++ )
+            {
+                producer.insert( 1.0 );
+            }
+        });
+    }
+    for( auto& t : threads ){ t.join(); }
+
+    ingestor.stop();
+
+    ASSERT_EQ( acc.get_count().value(), NUM_THREADS * NUM_SAMPLES );
+    ASSERT_DOUBLE_EQ( acc.get_sum().value(), NUM_THREADS * NUM_SAMPLES );
+    ASSERT_EQ( ingestor.dropped_count(), 0 );
+    ASSERT_EQ( ingestor.number_producers(), 0 );
+}
+
+/*****************************************************/
+/*          Test the drop-and-count overflow         */
+/*****************************************************/
+TEST( Async_Ingestor, Drop_On_Overflow )
+{
+    auto acc = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+
+    // Aggregator is not running, so the ring fills up
+    acc::Async_Ingestor<double> ingestor( 16, acc::Overflow_Policy::DROP );
+    auto producer = ingestor.create_producer( acc );
+    for( int i = 0; i < 100; i++ )
+    {
+        producer.insert( (double)i );
+    }
+    ASSERT_EQ( producer.dropped(), 84 );
+    ASSERT_EQ( ingestor.pending(), 16 );
+
+    ingestor.start();
+    ingestor.flush();
+    ASSERT_EQ( acc.get_count().value(), 16 );
+    ASSERT_DOUBLE_EQ( acc.get_max().value(), 15 );
+    ASSERT_DOUBLE_EQ( acc.last_entry(), 15 );
+}
+
+/*****************************************************/
+/*          Test blocking without an aggregator      */
+/*****************************************************/
+TEST( Async_Ingestor, Block_Without_Aggregator )
+{
+    auto acc = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+
+    // Never started, so a full ring is drained on the producer's thread
+    acc::Async_Ingestor<double> ingestor( 16, acc::Overflow_Policy::BLOCK );
+    auto producer = ingestor.create_producer( acc );
+    for( int i = 0; i < 100; i++ )
+    {
+        producer.insert( (double)i );
+    }
+    ASSERT_EQ( producer.dropped(), 0 );
+    ASSERT_EQ( acc.get_count().value() + (int64_t)ingestor.pending(), 100 );
+
+    // Same after the aggregator has been stopped
+    ingestor.start();
+    ingestor.stop();
+    ASSERT_EQ( acc.get_count().value(), 100 );
+    for( int i = 100; i < 200; i++ )
+    {
+        producer.insert( (double)i );
+    }
+    ASSERT_EQ( acc.get_count().value() + (int64_t)ingestor.pending(), 200 );
+
+    ingestor.start();
+    ingestor.flush();
+    ingestor.stop();
+    ASSERT_EQ( acc.get_count().value(), 200 );
+    ASSERT_DOUBLE_EQ( acc.get_max().value(), 199 );
+    ASSERT_DOUBLE_EQ( acc.last_entry(), 199 );
+}
+
+/*****************************************************/
+/*          Test weighted and instrumented targets   */
+/*****************************************************/
+TEST( Async_Ingestor, Accumulator_Variants )
+{
+    auto weighted     = acc::Accumulator<acc::FULL_FEATURE_SET,double,double>::create( "ms" );
+    auto instrumented = acc::Accumulator<acc::FULL_FEATURE_SET,double,void,acc::Instrumented_Mutex<>>::create( "ms" );
+
+    acc::Async_Ingestor<double> ingestor( 64, acc::Overflow_Policy::BLOCK );
+    ingestor.start();
+    {
+        auto weighted_producer     = ingestor.create_producer( weighted );
+        auto instrumented_producer = ingestor.create_producer( instrumented );
+        for( int i = 1; i <= 100; i++ )
+        {
+            weighted_producer.insert( (double)i );
+            instrumented_producer.insert( (double)i );
+        }
+    }
+    ingestor.stop();
+
+    ASSERT_DOUBLE_EQ( weighted.get_sum().value(), 5050 );
+    ASSERT_DOUBLE_EQ( weighted.get_mean().value(), 50.5 );
+    ASSERT_EQ( instrumented.get_count().value(), 100 );
+    ASSERT_DOUBLE_EQ( instrumented.get_sum().value(), 5050 );
+}
+
+/*****************************************************/
+/*          Test producers without a ring            */
+/*****************************************************/
+TEST( Async_Ingestor, Empty_Producer )
+{
+    auto acc = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+    acc::Async_Ingestor<double> ingestor;
+
+    acc::Async_Ingestor<double>::Producer empty;
+    ASSERT_FALSE( empty.valid() );
+    ASSERT_EQ( empty.dropped(), 0 );
+    ASSERT_THROW( empty.insert( 1.0 ), std::logic_error );
+
+    auto producer = ingestor.create_producer( acc );
+    ASSERT_TRUE( producer.valid() );
+    auto moved = std::move( producer );
+    ASSERT_TRUE( moved.valid() );
+    ASSERT_FALSE( producer.valid() );
+    ASSERT_THROW( producer.insert( 1.0 ), std::logic_error );
+}
@@ -0,0 +1,111 @@
+/**
+ * @file    TEST_Bivariate_Accumulator.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <random>
+
+// Project Libraries
+#include <lib-acc/Bivariate_Accumulator.hpp>
+
+/*************************************************************/
+/*          Empty and degenerate inputs                      */
+/*************************************************************/
+TEST( Bivariate_Accumulator, Empty )
+{
+    auto acc = acc::Bivariate_Accumulator::create( "ms", "%" );
+    ASSERT_EQ( acc.get_count(), 0 );
+    ASSERT_FALSE( acc.get_mean_x() );
+    ASSERT_FALSE( acc.get_correlation() );
+
+    // Constant x has no slope
+    acc.insert( 1, 2 );
+    acc.insert( 1, 3 );
+    ASSERT_FALSE( acc.get_slope() );
+    ASSERT_NEAR( acc.get_mean_y().value(), 2.5, 1e-12 );
+}
+
+/*************************************************************/
+/*          Exact line and known moments                     */
+/*************************************************************/
+TEST( Bivariate_Accumulator, Linear_Relation )
+{
+    auto acc = acc::Bivariate_Accumulator::create( "ms", "%" );
+    for( int i = 0; i < 100; i++ )
+    {
+        acc.insert( i, 3 - 0.5 * i );
+    }
+
+    ASSERT_NEAR( acc.get_slope().value(), -0.5, 1e-12 );
+    ASSERT_NEAR( acc.get_intercept().value(), 3, 1e-10 );
+    ASSERT_NEAR( acc.get_correlation().value(), -1, 1e-12 );
+    ASSERT_NEAR( acc.get_mean_x().value(), 49.5, 1e-12 );
+    ASSERT_NEAR( acc.get_variance_x().value(), ( 100.0 * 100.0 - 1 ) / 12, 1e-9 );
+    ASSERT_NEAR( acc.get_covariance().value(), -0.5 * acc.get_variance_x().value(), 1e-9 );
+}
+
+/*************************************************************/
+/*          Weights act as repeated samples                  */
+/*************************************************************/
+TEST( Bivariate_Accumulator, Weighted )
+{
+    auto weighted = acc::Bivariate_Accumulator::create( "", "" );
+    auto repeated = acc::Bivariate_Accumulator::create( "", "" );
+
+    std::mt19937 rng( 5 );
+    std::uniform_real_distribution<double> dist( 0, 10 );
+    for( int i = 0; i < 200; i++ )
+    {
+        const double x = dist( rng );
+        const double y = 2 * x + dist( rng );
+        const int    w = 1 + i % 4;
+        weighted.insert( x, y, w );
+        for( int j = 0; j < w; j++ )
+        {
+            repeated.insert( x, y );
+        }
+    }
+
+    ASSERT_NEAR( weighted.get_total_weight(), repeated.get_total_weight(), 1e-9 );
+    ASSERT_NEAR( weighted.get_mean_y().value(), repeated.get_mean_y().value(), 1e-9 );
+    ASSERT_NEAR( weighted.get_covariance().value(), repeated.get_covariance().value(), 1e-9 );
+    ASSERT_NEAR( weighted.get_correlation().value(), repeated.get_correlation().value(), 1e-9 );
+    ASSERT_NEAR( weighted.get_slope().value(), repeated.get_slope().value(), 1e-9 );
+}
+
+/*************************************************************/
+/*          Merging matches a single pass                    */
+/*************************************************************/
+TEST( Bivariate_Accumulator, Merge )
+{
+    auto whole = acc::Bivariate_Accumulator::create( "", "" );
+    auto part1 = acc::Bivariate_Accumulator::create( "", "" );
+    auto part2 = acc::Bivariate_Accumulator::create( "", "" );
+    auto empty = acc::Bivariate_Accumulator::create( "", "" );
+
+    std::mt19937 rng( 11 );
+    std::normal_distribution<double> dist( 100, 15 );
+    for( int i = 0; i < 1000; i++ )
+    {
+        const double x = dist( rng );
+        const double y = 0.25 * x + dist( rng );
+        whole.insert( x, y );
+        ( i < 300 ? part1 : part2 ).insert( x, y );
+    }
+
+    part1.merge( part2 );
+    part1.merge( empty );
+    empty.merge( part1 );
+
+    for( auto* merged : { &part1, &empty } )
+    {
+        ASSERT_EQ( merged->get_count(), whole.get_count() );
+        ASSERT_NEAR( merged->get_mean_x().value(), whole.get_mean_x().value(), 1e-9 );
+        ASSERT_NEAR( merged->get_variance_y().value(), whole.get_variance_y().value(), 1e-7 );
+        ASSERT_NEAR( merged->get_covariance().value(), whole.get_covariance().value(), 1e-7 );
+        ASSERT_NEAR( merged->get_slope().value(), whole.get_slope().value(), 1e-9 );
+    }
+}
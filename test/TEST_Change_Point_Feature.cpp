@@ -0,0 +1,131 @@
+/**
+ * @file    TEST_Change_Point_Feature.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <random>
+#include <vector>
+
+// Project Libraries
+#include <lib-acc/Accumulator.hpp>
+#include <lib-acc/Checkpoint.hpp>
+
+typedef boost::accumulators::stats<acc::count_stat,
+                                   acc::mean_stat,
+                                   acc::cusum_stat,
+                                   acc::page_hinkley_stat> CHANGE_POINT_TEST_SET;
+
+/*****************************************************************/
+/*          Stationary noise should not raise alarms             */
+/*****************************************************************/
+TEST( Change_Point_Feature, No_False_Alarm )
+{
+    std::mt19937 rng( 1234 );
+    std::normal_distribution<double> noise( 10, 1 );
+
+    auto acc = acc::Accumulator<CHANGE_POINT_TEST_SET,double>::create_with_params( "ms" );
+    for( int i = 0; i < 5000; i++ )
+    {
+        acc.insert( noise( rng ) );
+    }
+
+    ASSERT_TRUE( acc.has_cusum() );
+    ASSERT_TRUE( acc.has_page_hinkley() );
+    ASSERT_EQ( acc.get_cusum().value().detections, 0 );
+    ASSERT_EQ( acc.get_page_hinkley().value().detections, 0 );
+
+    // Keys longer than the pretty printer's padding width
+    ASSERT_NE( acc.toLogString().find( "Page-Hinkley Change Points: 0" ), std::string::npos );
+}
+
+/*****************************************************************/
+/*          A mean shift is reported once, shortly after         */
+/*****************************************************************/
+TEST( Change_Point_Feature, Mean_Shift )
+{
+    std::mt19937 rng( 42 );
+    std::normal_distribution<double> noise( 0, 1 );
+
+    std::vector<acc::Change_Point_Event> events;
+    auto acc = acc::Accumulator<CHANGE_POINT_TEST_SET,double>::create_with_params( "ms",
+                                                                                   acc::change_point_callback = acc::Change_Point_Callback(
+                                                                                       [&events]( const acc::Change_Point_Event& event ){ events.push_back( event ); } ) );
+    for( int i = 0; i < 1000; i++ )
+    {
+        acc.insert( 10 + noise( rng ) );
+    }
+    for( int i = 0; i < 1000; i++ )
+    {
+        acc.insert( 13 + noise( rng ) );
+    }
+
+    auto cusum = acc.get_cusum().value();
+    ASSERT_EQ( cusum.detections, 1 );
+    ASSERT_EQ( cusum.last_event.value().type, acc::Change_Point_Type::MEAN_INCREASE );
+    ASSERT_GT( cusum.last_event.value().sample_index, 1000 );
+    ASSERT_LT( cusum.last_event.value().sample_index, 1020 );
+    ASSERT_NEAR( cusum.last_event.value().reference_mean, 10, 0.5 );
+
+    auto page_hinkley = acc.get_page_hinkley().value();
+    ASSERT_EQ( page_hinkley.detections, 1 );
+    ASSERT_EQ( page_hinkley.last_event.value().type, acc::Change_Point_Type::MEAN_INCREASE );
+    ASSERT_GT( page_hinkley.last_event.value().sample_index, 1000 );
+    ASSERT_LT( page_hinkley.last_event.value().sample_index, 1050 );
+
+    // Both detectors share the callback
+    ASSERT_EQ( events.size(), 2 );
+}
+
+/*****************************************************************/
+/*          Variance growth is caught by CUSUM                   */
+/*****************************************************************/
+TEST( Change_Point_Feature, Variance_Shift )
+{
+    std::mt19937 rng( 7 );
+    std::normal_distribution<double> noise( 0, 1 );
+
+    auto acc = acc::Accumulator<CHANGE_POINT_TEST_SET,double>::create_with_params( "ms",
+                                                                                   acc::change_point_warmup = 200 );
+    for( int i = 0; i < 1000; i++ )
+    {
+        acc.insert( 5 + noise( rng ) );
+    }
+    for( int i = 0; i < 200; i++ )
+    {
+        acc.insert( 5 + 4 * noise( rng ) );
+    }
+
+    auto cusum = acc.get_cusum().value();
+    ASSERT_GE( cusum.detections, 1 );
+
+    // Large single samples can also trip a mean sum first, but never a variance decrease
+    ASSERT_NE( cusum.last_event.value().type, acc::Change_Point_Type::VARIANCE_DECREASE );
+    ASSERT_GT( cusum.last_event.value().sample_index, 1000 );
+    ASSERT_LT( cusum.last_event.value().sample_index, 1100 );
+}
+
+/*****************************************************************/
+/*          Detector state survives a checkpoint                 */
+/*****************************************************************/
+TEST( Change_Point_Feature, Checkpoint )
+{
+    auto source = acc::Accumulator<CHANGE_POINT_TEST_SET,double>::create_with_params( "ms" );
+    for( int i = 0; i < 100; i++ )
+    {
+        source.insert( 1 + ( i % 3 ) );
+    }
+    for( int i = 0; i < 100; i++ )
+    {
+        source.insert( 50 );
+    }
+
+    ASSERT_GT( source.get_cusum().value().detections, 0 );
+
+    auto restored = acc::Accumulator<CHANGE_POINT_TEST_SET,double>::create_with_params( "ms" );
+    acc::checkpoint::deserialize( restored, acc::checkpoint::serialize( source ) );
+    ASSERT_EQ( restored.get_cusum().value().detections, source.get_cusum().value().detections );
+    ASSERT_EQ( restored.get_page_hinkley().value().detections, source.get_page_hinkley().value().detections );
+}
@@ -0,0 +1,267 @@
+/**
+ * @file    TEST_Checkpoint.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <random>
+
+// Project Libraries
+#include <lib-acc/Accumulator.hpp>
+#include <lib-acc/Checkpoint.hpp>
+
+typedef boost::accumulators::stats<acc::count_stat,
+                                   acc::mean_stat,
+                                   acc::reservoir_stat> RESERVOIR_TEST_SET;
+
+typedef boost::accumulators::stats<acc::count_stat,
+                                   acc::mean_stat,
+                                   acc::cusum_stat,
+                                   acc::page_hinkley_stat> CHANGE_POINT_TEST_SET;
+
+/*************************************************************/
+/*          Round trip the full feature set in memory        */
+/*************************************************************/
+TEST( Checkpoint, Full_Feature_Set )
+{
+    auto source = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+    for( int i = 1; i <= 1000; i++ )
+    {
+        source.insert( i * 0.5 );
+    }
+
+    auto buffer = acc::checkpoint::serialize( source );
+
+    auto restored = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "" );
+    ASSERT_EQ( acc::checkpoint::deserialize( restored, buffer ), buffer.size() );
+
+    ASSERT_EQ( restored.number_items_inserted(), source.number_items_inserted() );
+    ASSERT_EQ( restored.get_count().value(), source.get_count().value() );
+    ASSERT_EQ( restored.get_mean().value(), source.get_mean().value() );
+    ASSERT_EQ( restored.get_min().value(), source.get_min().value() );
+    ASSERT_EQ( restored.get_max().value(), source.get_max().value() );
+    ASSERT_EQ( restored.get_sum().value(), source.get_sum().value() );
+    ASSERT_EQ( restored.get_variance().value(), source.get_variance().value() );
+    ASSERT_EQ( restored.last_entry(), source.last_entry() );
+    ASSERT_EQ( restored.toLogString(), source.toLogString() );
+
+    // Restored accumulator keeps going from where the source left off
+    source.insert( 7 );
+    restored.insert( 7 );
+    ASSERT_EQ( restored.get_mean().value(), source.get_mean().value() );
+}
+
+/*************************************************************/
+/*          Rolling windows come back with their contents    */
+/*************************************************************/
+TEST( Checkpoint, Rolling_Window )
+{
+    auto source = acc::Accumulator<acc::ROLLING_FEATURE_SET,double>::create_rolling( "ms", 10 );
+    for( int i = 0; i < 25; i++ )
+    {
+        source.insert( i );
+    }
+
+    auto buffer = acc::checkpoint::serialize( source );
+
+    // Window size is restored from the checkpoint
+    auto restored = acc::Accumulator<acc::ROLLING_FEATURE_SET,double>::create_rolling( "ms", 1 );
+    acc::checkpoint::deserialize( restored, buffer );
+    ASSERT_EQ( restored.get_rolling_mean().value(), source.get_rolling_mean().value() );
+    ASSERT_EQ( restored.get_rolling_sum().value(), source.get_rolling_sum().value() );
+
+    // Old samples must still roll out of the restored window
+    for( int i = 25; i < 35; i++ )
+    {
+        source.insert( i );
+        restored.insert( i );
+        ASSERT_EQ( restored.get_rolling_sum().value(), source.get_rolling_sum().value() );
+    }
+    ASSERT_NEAR( restored.get_rolling_mean().value(), 29.5, 1e-9 );
+}
+
+/*************************************************************/
+/*          Reservoir samples and sampler state survive      */
+/*************************************************************/
+TEST( Checkpoint, Reservoir )
+{
+    auto source = acc::Accumulator<RESERVOIR_TEST_SET,double>::create_with_params( "ms", acc::reservoir_size = 50 );
+    for( int i = 0; i < 5000; i++ )
+    {
+        source.insert( i );
+    }
+
+    auto buffer = acc::checkpoint::serialize( source );
+    auto restored = acc::Accumulator<RESERVOIR_TEST_SET,double>::create_with_params( "ms", acc::reservoir_size = 1 );
+    acc::checkpoint::deserialize( restored, buffer );
+    ASSERT_EQ( restored.get_reservoir().value(), source.get_reservoir().value() );
+
+    // Same generator state, so both make the same replacement decisions
+    for( int i = 5000; i < 10000; i++ )
+    {
+        source.insert( i );
+        restored.insert( i );
+    }
+    ASSERT_EQ( restored.get_reservoir().value(), source.get_reservoir().value() );
+}
+
+/*************************************************************/
+/*          Change-point alarms come back with their event   */
+/*************************************************************/
+TEST( Checkpoint, Change_Point )
+{
+    std::mt19937 rng( 7 );
+    std::normal_distribution<double> noise( 0, 1 );
+
+    auto source = acc::Accumulator<CHANGE_POINT_TEST_SET,double>::create_with_params( "ms" );
+    for( int i = 0; i < 500; i++ )
+    {
+        source.insert( 10 + noise( rng ) );
+    }
+    for( int i = 0; i < 500; i++ )
+    {
+        source.insert( 15 + noise( rng ) );
+    }
+    ASSERT_GE( source.get_cusum().value().detections, 1 );
+    ASSERT_GE( source.get_page_hinkley().value().detections, 1 );
+
+    auto buffer = acc::checkpoint::serialize( source );
+    auto restored = acc::Accumulator<CHANGE_POINT_TEST_SET,double>::create_with_params( "ms" );
+    acc::checkpoint::deserialize( restored, buffer );
+
+    for( auto [src, dst] : { std::make_pair( source.get_cusum().value(), restored.get_cusum().value() ),
+                             std::make_pair( source.get_page_hinkley().value(), restored.get_page_hinkley().value() ) } )
+    {
+        ASSERT_EQ( dst.detections, src.detections );
+        ASSERT_TRUE( dst.last_event.has_value() );
+        const auto& expected = src.last_event.value();
+        const auto& actual   = dst.last_event.value();
+        ASSERT_EQ( actual.detector, expected.detector );
+        ASSERT_EQ( actual.type, expected.type );
+        ASSERT_EQ( actual.sample_index, expected.sample_index );
+        ASSERT_EQ( actual.value, expected.value );
+        ASSERT_EQ( actual.reference_mean, expected.reference_mean );
+        ASSERT_EQ( actual.reference_stddev, expected.reference_stddev );
+        ASSERT_EQ( actual.statistic, expected.statistic );
+    }
+
+    // No alarm yet round trips as no event
+    auto quiet = acc::Accumulator<CHANGE_POINT_TEST_SET,double>::create_with_params( "ms" );
+    quiet.insert( 1 );
+    acc::checkpoint::deserialize( restored, acc::checkpoint::serialize( quiet ) );
+    ASSERT_EQ( restored.get_cusum().value().detections, 0 );
+    ASSERT_FALSE( restored.get_cusum().value().last_event.has_value() );
+}
+
+/*************************************************************/
+/*          Corrupt or mismatched data is rejected           */
+/*************************************************************/
+TEST( Checkpoint, Invalid_Data )
+{
+    auto source = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+    source.insert( 1 );
+    auto buffer = acc::checkpoint::serialize( source );
+
+    auto restored = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+    std::vector<char> truncated( buffer.begin(), buffer.end() - 4 );
+    ASSERT_THROW( acc::checkpoint::deserialize( restored, truncated ), std::runtime_error );
+
+    std::vector<char> bad_magic = buffer;
+    bad_magic[0] = 'X';
+    ASSERT_THROW( acc::checkpoint::deserialize( restored, bad_magic ), std::runtime_error );
+
+    auto float_acc = acc::Accumulator<acc::FULL_FEATURE_SET,float>::create( "ms" );
+    ASSERT_THROW( acc::checkpoint::deserialize( float_acc, buffer ), std::runtime_error );
+
+    // Same sample type, different feature set
+    typedef boost::accumulators::stats<acc::count_stat,acc::sum_stat> COUNT_SUM_SET;
+    auto count_sum = acc::Accumulator<COUNT_SUM_SET,double>::create( "ms" );
+    count_sum.insert( 5 );
+    ASSERT_THROW( acc::checkpoint::deserialize( count_sum, buffer ), std::runtime_error );
+    ASSERT_EQ( count_sum.get_count().value(), 1 );
+    ASSERT_EQ( count_sum.get_sum().value(), 5 );
+}
+
+/*************************************************************/
+/*          Failed restores leave the accumulator intact     */
+/*************************************************************/
+TEST( Checkpoint, Failed_Restore_Keeps_State )
+{
+    auto source = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+    for( int i = 0; i < 10; i++ )
+    {
+        source.insert( i );
+    }
+    auto buffer = acc::checkpoint::serialize( source );
+
+    acc::checkpoint::Checkpoint_Header header;
+    std::memcpy( &header, buffer.data(), sizeof(header) );
+
+    auto restored = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "us" );
+    restored.insert( 100 );
+    const auto expected = restored.toLogString();
+
+    // Payload cut short partway through the Boost set
+    std::vector<char> short_payload( buffer.begin(), buffer.end() - 16 );
+    acc::checkpoint::Checkpoint_Header short_header = header;
+    short_header.payload_size -= 16;
+    std::memcpy( short_payload.data(), &short_header, sizeof(short_header) );
+    ASSERT_THROW( acc::checkpoint::deserialize( restored, short_payload ), std::runtime_error );
+    ASSERT_EQ( restored.number_items_inserted(), 1 );
+    ASSERT_EQ( restored.toLogString(), expected );
+
+    // Trailing bytes the accumulator never read
+    std::vector<char> long_payload = buffer;
+    long_payload.resize( buffer.size() + 8 );
+    acc::checkpoint::Checkpoint_Header long_header = header;
+    long_header.payload_size += 8;
+    std::memcpy( long_payload.data(), &long_header, sizeof(long_header) );
+    ASSERT_THROW( acc::checkpoint::deserialize( restored, long_payload ), std::runtime_error );
+    ASSERT_EQ( restored.number_items_inserted(), 1 );
+    ASSERT_EQ( restored.toLogString(), expected );
+}
+
+/*************************************************************/
+/*          Write several accumulators and map them back     */
+/*************************************************************/
+TEST( Checkpoint, File_Round_Trip )
+{
+    auto latency = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+    auto window  = acc::Accumulator<acc::ROLLING_FEATURE_SET,double>::create_rolling( "MB", 4 );
+    for( int i = 0; i < 100; i++ )
+    {
+        latency.insert( i );
+        window.insert( i * 2 );
+    }
+
+    const std::string path = ( std::filesystem::temp_directory_path() / "TEST_Checkpoint.bin" ).string();
+
+    acc::checkpoint::Checkpoint_Writer writer;
+    writer.add( "latency", latency );
+    writer.add( "window", window );
+    ASSERT_EQ( writer.size(), 2 );
+    writer.write( path );
+
+    {
+        acc::checkpoint::Checkpoint_Reader reader( path );
+        ASSERT_TRUE( reader.contains( "latency" ) );
+        ASSERT_TRUE( reader.contains( "window" ) );
+        ASSERT_FALSE( reader.contains( "missing" ) );
+
+        auto latency_restored = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "" );
+        auto window_restored  = acc::Accumulator<acc::ROLLING_FEATURE_SET,double>::create_rolling( "", 1 );
+        ASSERT_TRUE( reader.restore( "latency", latency_restored ) );
+        ASSERT_TRUE( reader.restore( "window", window_restored ) );
+        ASSERT_FALSE( reader.restore( "missing", latency_restored ) );
+
+        ASSERT_EQ( latency_restored.get_mean().value(), latency.get_mean().value() );
+        ASSERT_EQ( window_restored.get_rolling_mean().value(), window.get_rolling_mean().value() );
+        ASSERT_EQ( window_restored.toLogString(), window.toLogString() );
+    }
+    std::remove( path.c_str() );
+}
@@ -0,0 +1,83 @@
+/**
+ * @file    TEST_Complexity_Estimator.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <cmath>
+#include <random>
+
+// Project Libraries
+#include <lib-acc/Complexity_Estimator.hpp>
+
+/*************************************************************/
+/*          Not enough data gives no estimate                */
+/*************************************************************/
+TEST( Complexity_Estimator, Empty )
+{
+    auto estimator = acc::Complexity_Estimator::create( "ms" );
+    ASSERT_FALSE( estimator.get_exponent() );
+
+    // Same size twice says nothing about scaling
+    estimator.insert( 100, 1.0 );
+    estimator.insert( 100, 2.0 );
+    ASSERT_FALSE( estimator.get_exponent() );
+
+    // Non-positive values are ignored
+    estimator.insert( 0, 1.0 );
+    estimator.insert( 10, -1.0 );
+    ASSERT_EQ( estimator.get_count(), 2 );
+}
+
+/*************************************************************/
+/*          Exact power laws are recovered exactly           */
+/*************************************************************/
+TEST( Complexity_Estimator, Exact_Power_Law )
+{
+    auto linear    = acc::Complexity_Estimator::create( "ms" );
+    auto quadratic = acc::Complexity_Estimator::create( "ms" );
+    for( int n = 1; n <= 1000; n++ )
+    {
+        linear.insert( n, 0.5 * n );
+        quadratic.insert( n, 3e-4 * n * n );
+    }
+
+    ASSERT_NEAR( linear.get_exponent().value(), 1.0, 1e-9 );
+    ASSERT_NEAR( linear.get_coefficient().value(), 0.5, 1e-9 );
+    ASSERT_NEAR( quadratic.get_exponent().value(), 2.0, 1e-9 );
+    ASSERT_NEAR( quadratic.get_coefficient().value(), 3e-4, 1e-12 );
+    ASSERT_NEAR( quadratic.get_r_squared().value(), 1.0, 1e-9 );
+    ASSERT_NEAR( quadratic.get_exponent_std_error().value(), 0.0, 1e-6 );
+}
+
+/*************************************************************/
+/*          Noisy quadratic cost is flagged, linear is not   */
+/*************************************************************/
+TEST( Complexity_Estimator, Noisy_Scaling )
+{
+    std::mt19937 rng( 99 );
+    std::lognormal_distribution<double> noise( 0, 0.3 );
+
+    auto linear    = acc::Complexity_Estimator::create( "ms" );
+    auto quadratic = acc::Complexity_Estimator::create( "ms" );
+    for( int i = 0; i < 5000; i++ )
+    {
+        const double n = 10 + i;
+        linear.insert( n, 2e-3 * n * noise( rng ) );
+        quadratic.insert( n, 1e-6 * n * n * noise( rng ) );
+    }
+
+    auto interval = quadratic.get_exponent_confidence_interval().value();
+    ASSERT_LT( interval.first, 2.0 );
+    ASSERT_GT( interval.second, 2.0 );
+    ASSERT_LT( interval.second - interval.first, 0.1 );
+
+    ASSERT_TRUE( quadratic.exceeds_exponent( 1.5 ) );
+    ASSERT_FALSE( linear.exceeds_exponent( 1.5 ) );
+    ASSERT_NEAR( linear.get_exponent().value(), 1.0, 0.05 );
+
+    auto report = quadratic.toLogString();
+    ASSERT_NE( report.find( "O(n^2.0" ), std::string::npos );
+}
@@ -0,0 +1,117 @@
+/**
+ * @file    TEST_Count_Min_Sketch.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <cstring>
+#include <random>
+#include <string>
+
+// Project Libraries
+#include <lib-acc/Checkpoint.hpp>
+#include <lib-acc/Count_Min_Sketch.hpp>
+
+/*************************************************************/
+/*          Exact when keys do not collide                   */
+/*************************************************************/
+TEST( Count_Min_Sketch, Few_Keys )
+{
+    auto sketch = acc::Count_Min_Sketch<double>::create( "ms", 1000, 4 );
+    ASSERT_EQ( sketch.width(), 1024 );
+    ASSERT_EQ( sketch.depth(), 4 );
+
+    sketch.insert( std::string( "alice" ), 3 );
+    sketch.insert( std::string( "alice" ), 5 );
+    sketch.insert( std::string( "bob" ), 10 );
+
+    ASSERT_EQ( sketch.get_count( std::string( "alice" ) ), 2 );
+    ASSERT_DOUBLE_EQ( sketch.get_sum( std::string( "alice" ) ), 8 );
+    ASSERT_DOUBLE_EQ( sketch.get_mean( std::string( "bob" ) ).value(), 10 );
+    ASSERT_FALSE( sketch.get_mean( std::string( "carol" ) ) );
+    ASSERT_EQ( sketch.get_total_count(), 3 );
+
+    // Negative samples count but add zero to every sum, total included
+    sketch.insert( std::string( "dave" ), -4 );
+    ASSERT_EQ( sketch.get_count( std::string( "dave" ) ), 1 );
+    ASSERT_DOUBLE_EQ( sketch.get_sum( std::string( "dave" ) ), 0 );
+    ASSERT_EQ( sketch.get_total_count(), 4 );
+    ASSERT_DOUBLE_EQ( sketch.get_total_sum(), 18 );
+}
+
+/*************************************************************/
+/*          Never under-estimates, errors stay in bound      */
+/*************************************************************/
+TEST( Count_Min_Sketch, Error_Bound )
+{
+    auto sketch = acc::Count_Min_Sketch<double>::create( "ms", 512, 4 );
+
+    std::mt19937 rng( 11 );
+    std::uniform_int_distribution<int> keys( 0, 20000 );
+    std::vector<int> truth( 20001, 0 );
+    for( int i = 0; i < 100000; i++ )
+    {
+        int key = ( i % 4 == 0 ) ? 7 : keys( rng );
+        truth[key]++;
+        sketch.insert( key, 1 );
+    }
+
+    int within_bound = 0;
+    for( int key = 0; key <= 20000; key++ )
+    {
+        ASSERT_GE( sketch.get_count( key ), (uint64_t)truth[key] );
+        within_bound += ( sketch.get_count( key ) - truth[key] <= sketch.get_count_error_bound() );
+    }
+    ASSERT_GT( within_bound, 20001 * 0.95 );
+
+    // The heavy key is tight
+    ASSERT_NEAR( (double)sketch.get_count( 7 ), truth[7], truth[7] * 0.01 );
+}
+
+/*************************************************************/
+/*          Merge and checkpoint round trip                  */
+/*************************************************************/
+TEST( Count_Min_Sketch, Merge_And_Checkpoint )
+{
+    auto first  = acc::Count_Min_Sketch<double>::create( "ms", 256, 3 );
+    auto second = acc::Count_Min_Sketch<double>::create( "ms", 256, 3 );
+    first.insert( 1, 2.5 );
+    second.insert( 1, 4.5 );
+    second.insert( 2, 1.0 );
+
+    first.merge( second );
+    ASSERT_EQ( first.get_count( 1 ), 2 );
+    ASSERT_DOUBLE_EQ( first.get_sum( 1 ), 7 );
+    ASSERT_DOUBLE_EQ( first.get_total_sum(), 8 );
+
+    auto narrow = acc::Count_Min_Sketch<double>::create( "ms", 128, 3 );
+    ASSERT_THROW( first.merge( narrow ), std::invalid_argument );
+
+    // Shape comes back from the checkpoint
+    acc::checkpoint::deserialize( narrow, acc::checkpoint::serialize( first ) );
+    ASSERT_EQ( narrow.width(), 256 );
+    ASSERT_EQ( narrow.get_count( 1 ), 2 );
+    ASSERT_EQ( narrow.toLogString(), first.toLogString() );
+
+    // A bad shape throws and leaves the sketch as it was
+    auto bytes = acc::checkpoint::serialize( second );
+    const uint64_t bad_width = 100;
+    std::memcpy( bytes.data() + sizeof(acc::checkpoint::Checkpoint_Header), &bad_width, sizeof(bad_width) );
+    ASSERT_THROW( acc::checkpoint::deserialize( narrow, bytes ), std::runtime_error );
+    ASSERT_EQ( narrow.width(), 256 );
+    ASSERT_EQ( narrow.get_count( 1 ), 2 );
+    ASSERT_DOUBLE_EQ( narrow.get_total_sum(), 8 );
+
+    // So do trailing bytes the sketch never read
+    auto padded = acc::checkpoint::serialize( second );
+    acc::checkpoint::Checkpoint_Header header;
+    std::memcpy( &header, padded.data(), sizeof(header) );
+    header.payload_size += 8;
+    std::memcpy( padded.data(), &header, sizeof(header) );
+    padded.resize( padded.size() + 8 );
+    ASSERT_THROW( acc::checkpoint::deserialize( narrow, padded ), std::runtime_error );
+    ASSERT_EQ( narrow.get_count( 1 ), 2 );
+    ASSERT_DOUBLE_EQ( narrow.get_total_sum(), 8 );
+}
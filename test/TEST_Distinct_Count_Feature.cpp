@@ -0,0 +1,129 @@
+/**
+ * @file    TEST_Distinct_Count_Feature.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <string>
+
+// Project Libraries
+#include <lib-acc/Accumulator.hpp>
+#include <lib-acc/Checkpoint.hpp>
+
+typedef boost::accumulators::stats<acc::count_stat,
+                                   acc::mean_stat,
+                                   acc::distinct_count_stat> DISTINCT_TEST_SET;
+
+/*************************************************************/
+/*          Estimate stays within a few percent              */
+/*************************************************************/
+TEST( Distinct_Count_Feature, Accuracy )
+{
+    for( int distinct : { 10, 1000, 20000, 500000 } )
+    {
+        acc::Hyper_Log_Log sketch;
+        for( int i = 0; i < distinct; i++ )
+        {
+            sketch.insert_hash( i );
+            sketch.insert_hash( i );
+        }
+        ASSERT_NEAR( sketch.estimate(), distinct, distinct * 0.03 + 1 ) << distinct;
+    }
+
+    ASSERT_EQ( acc::Hyper_Log_Log().estimate(), 0 );
+    ASSERT_EQ( acc::Hyper_Log_Log( 14 ).memory_footprint(), 16384 );
+}
+
+/*************************************************************/
+/*          Merged sketches count the union                  */
+/*************************************************************/
+TEST( Distinct_Count_Feature, Merge )
+{
+    acc::Hyper_Log_Log first;
+    acc::Hyper_Log_Log second;
+    for( int i = 0; i < 30000; i++ )
+    {
+        first.insert_hash( i );
+        second.insert_hash( i + 15000 );
+    }
+    first.merge( second );
+    ASSERT_NEAR( first.estimate(), 45000, 45000 * 0.03 );
+
+    acc::Hyper_Log_Log other_precision( 10 );
+    ASSERT_THROW( first.merge( other_precision ), std::invalid_argument );
+}
+
+/*************************************************************/
+/*          Feature counts keys, or values without keys      */
+/*************************************************************/
+TEST( Distinct_Count_Feature, Accumulator )
+{
+    auto by_value = acc::Accumulator<DISTINCT_TEST_SET,double>::create_with_params( "ms" );
+    auto by_key   = acc::Accumulator<DISTINCT_TEST_SET,double>::create_with_params( "ms",
+                                                                                    acc::distinct_count_precision = 12 );
+    for( int i = 0; i < 10000; i++ )
+    {
+        by_value.insert( i % 100 );
+        by_key.insert_with_key( 1.0, "555-" + std::to_string( i % 5000 ) );
+    }
+
+    ASSERT_TRUE( by_value.has_distinct_count() );
+    ASSERT_NEAR( by_value.get_distinct_count().value(), 100, 3 );
+    ASSERT_NEAR( by_key.get_distinct_count().value(), 5000, 5000 * 0.05 );
+    ASSERT_EQ( by_key.get_distinct_sketch().value().precision(), 12 );
+    ASSERT_DOUBLE_EQ( by_key.get_mean().value(), 1.0 );
+    ASSERT_NE( by_key.toLogString().find( "Distinct Count" ), std::string::npos );
+
+    auto full = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+    full.insert_with_key( 2.0, 17 );
+    ASSERT_FALSE( full.get_distinct_count() );
+
+    // Registers survive a checkpoint
+    auto restored = acc::Accumulator<DISTINCT_TEST_SET,double>::create_with_params( "ms" );
+    acc::checkpoint::deserialize( restored, acc::checkpoint::serialize( by_key ) );
+    ASSERT_EQ( restored.get_distinct_count().value(), by_key.get_distinct_count().value() );
+}
+
+/*************************************************************/
+/*          Corrupt sketches in a checkpoint are rejected    */
+/*************************************************************/
+TEST( Distinct_Count_Feature, Bad_Checkpoint )
+{
+    acc::Hyper_Log_Log sketch( 4 );
+    for( int i = 0; i < 100; i++ )
+    {
+        sketch.insert_hash( i );
+    }
+    const double expected = sketch.estimate();
+
+    auto load = [&]( int precision, const std::vector<uint8_t>& registers )
+    {
+        std::vector<char> buffer;
+        acc::archive::Binary_Output_Archive out( buffer, acc::checkpoint::FORMAT_VERSION );
+        out << precision << registers;
+        acc::archive::Binary_Input_Archive in( buffer.data(), buffer.size(), acc::checkpoint::FORMAT_VERSION );
+        sketch.serialize( in, 0 );
+    };
+
+    // Precision outside 4 to 18
+    ASSERT_THROW( load( 20, std::vector<uint8_t>( size_t(1) << 20, 0 ) ), std::runtime_error );
+    ASSERT_THROW( load( 3, std::vector<uint8_t>( 8, 0 ) ), std::runtime_error );
+
+    // Register count that doesn't match the precision
+    ASSERT_THROW( load( 4, std::vector<uint8_t>( 15, 0 ) ), std::runtime_error );
+
+    // Rank past 64 - P + 1
+    std::vector<uint8_t> registers( 16, 0 );
+    registers[3] = 62;
+    ASSERT_THROW( load( 4, registers ), std::runtime_error );
+
+    ASSERT_EQ( sketch.precision(), 4 );
+    ASSERT_EQ( sketch.estimate(), expected );
+
+    // The largest valid rank still loads
+    registers[3] = 61;
+    load( 4, registers );
+    ASSERT_EQ( sketch.memory_footprint(), 16 );
+}
@@ -0,0 +1,142 @@
+/**
+ * @file    TEST_Exemplar_Feature.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Project Libraries
+#include <lib-acc/Accumulator.hpp>
+#include <lib-acc/Checkpoint.hpp>
+
+typedef boost::accumulators::stats<acc::count_stat,
+                                   acc::max_stat,
+                                   acc::exemplars_stat> EXEMPLAR_TEST_SET;
+
+/*************************************************************/
+/*          Contexts are fixed size and truncate             */
+/*************************************************************/
+TEST( Exemplar_Feature, Context )
+{
+    ASSERT_TRUE( acc::Exemplar_Context().empty() );
+    ASSERT_EQ( acc::Exemplar_Context( "req-42" ).str(), "req-42" );
+    ASSERT_EQ( acc::Exemplar_Context( (uint64_t)0xbeef ).str(), "000000000000beef" );
+
+    const std::string long_key( 100, 'x' );
+    ASSERT_EQ( acc::Exemplar_Context( long_key ).view().size(), acc::Exemplar_Context::MAX_LENGTH );
+    ASSERT_EQ( sizeof( acc::Exemplar_Context ), 32 );
+}
+
+/*************************************************************/
+/*          Keeps the top N, largest first                   */
+/*************************************************************/
+TEST( Exemplar_Feature, Top_N )
+{
+    auto acc = acc::Accumulator<EXEMPLAR_TEST_SET,double>::create_with_params( "ms", acc::exemplar_count = 3 );
+    ASSERT_TRUE( acc.has_exemplars() );
+    ASSERT_TRUE( acc.get_exemplars().value().empty() );
+
+    for( int i = 0; i < 1000; i++ )
+    {
+        // Scrambled order, with 900 ms somewhere in the middle
+        const double value = ( i == 517 ) ? 900 : ( ( i * 7919 ) % 1000 ) / 10.0;
+        acc.insert( value, acc::Exemplar_Context( "req-" + std::to_string( i ) ) );
+    }
+
+    // Samples without a context never become exemplars
+    acc.insert( 5000 );
+
+    auto exemplars = acc.get_exemplars().value();
+    ASSERT_EQ( exemplars.size(), 3 );
+    ASSERT_EQ( exemplars[0].value, 900 );
+    ASSERT_EQ( exemplars[0].context.str(), "req-517" );
+    ASSERT_EQ( exemplars[1].value, 99.9 );
+    ASSERT_EQ( exemplars[2].value, 99.8 );
+    ASSERT_EQ( acc.get_max().value(), 5000 );
+    ASSERT_EQ( acc.get_count().value(), 1001 );
+
+    ASSERT_NE( acc.toLogString().find( "ms [req-517]" ), std::string::npos );
+}
+
+/*************************************************************/
+/*          Other sets and weighted sets                     */
+/*************************************************************/
+TEST( Exemplar_Feature, Other_Sets )
+{
+    auto plain = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+    plain.insert( 3, acc::Exemplar_Context( "a" ) );
+    ASSERT_FALSE( plain.has_exemplars() );
+    ASSERT_FALSE( plain.get_exemplars() );
+    ASSERT_EQ( plain.get_mean().value(), 3 );
+
+    auto weighted = acc::Accumulator<EXEMPLAR_TEST_SET,double,double>::create( "ms" );
+    weighted.insert( 3, acc::Exemplar_Context( "a" ) );
+    weighted.insert( 4, 2.0 );
+    ASSERT_EQ( weighted.get_exemplars().value().size(), 1 );
+    ASSERT_EQ( weighted.get_exemplars().value()[0].context.str(), "a" );
+}
+
+/*************************************************************/
+/*          Exemplars survive a checkpoint                   */
+/*************************************************************/
+TEST( Exemplar_Feature, Checkpoint )
+{
+    auto acc = acc::Accumulator<EXEMPLAR_TEST_SET,double>::create( "ms" );
+    for( int i = 0; i < 20; i++ )
+    {
+        acc.insert( i, acc::Exemplar_Context( (uint64_t)i ) );
+    }
+
+    auto restored = acc::Accumulator<EXEMPLAR_TEST_SET,double>::create( "ms" );
+    acc::checkpoint::deserialize( restored, acc::checkpoint::serialize( acc ) );
+
+    auto exemplars = restored.get_exemplars().value();
+    ASSERT_EQ( exemplars.size(), acc::DEFAULT_EXEMPLAR_COUNT );
+    ASSERT_EQ( exemplars[0].value, 19 );
+    ASSERT_EQ( exemplars[0].context, acc::Exemplar_Context( (uint64_t)19 ) );
+    ASSERT_EQ( exemplars.back().value, 15 );
+}
+
+/*************************************************************/
+/*          Out-of-range sizes in a checkpoint are rejected  */
+/*************************************************************/
+TEST( Exemplar_Feature, Bad_Checkpoint )
+{
+    const acc::Exemplar_Context original( "request-7" );
+
+    // Length past MAX_LENGTH
+    std::vector<char> buffer;
+    acc::archive::Binary_Output_Archive out( buffer, acc::checkpoint::FORMAT_VERSION );
+    out << (uint8_t)200;
+    for( size_t i = 0; i < acc::Exemplar_Context::MAX_LENGTH; i++ )
+    {
+        out << 'x';
+    }
+    auto context = original;
+    acc::archive::Binary_Input_Archive in( buffer.data(), buffer.size(), acc::checkpoint::FORMAT_VERSION );
+    ASSERT_THROW( context.serialize( in, 0 ), std::runtime_error );
+    ASSERT_EQ( context, original );
+
+    // More exemplars than the capacity
+    auto acc = acc::Accumulator<EXEMPLAR_TEST_SET,double>::create( "ms" );
+    acc.insert( 1, original );
+    auto bytes = acc::checkpoint::serialize( acc );
+
+    std::vector<char> sizes;
+    acc::archive::Binary_Output_Archive sizes_out( sizes, acc::checkpoint::FORMAT_VERSION );
+    sizes_out << (size_t)acc::DEFAULT_EXEMPLAR_COUNT << (size_t)1;
+    auto at = std::search( bytes.begin(), bytes.end(), sizes.begin(), sizes.end() );
+    ASSERT_NE( at, bytes.end() );
+    const size_t too_many = acc::DEFAULT_EXEMPLAR_COUNT + 1;
+    std::memcpy( &*at + sizeof(size_t), &too_many, sizeof(too_many) );
+
+    auto restored = acc::Accumulator<EXEMPLAR_TEST_SET,double>::create( "ms" );
+    ASSERT_THROW( acc::checkpoint::deserialize( restored, bytes ), std::runtime_error );
+    ASSERT_TRUE( restored.get_exemplars().value().empty() );
+}
@@ -0,0 +1,67 @@
+/**
+ * @file    TEST_Gauge_Poller.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Project Libraries
+#include <lib-acc/Gauge_Poller.hpp>
+
+/*************************************************************/
+/*          Values are weighted by how long they held        */
+/*************************************************************/
+TEST( Gauge_Poller, Time_Weighting )
+{
+    double level = 10;
+    acc::Gauge gauge( "Depth", "items", [&level](){ return level; } );
+    ASSERT_FALSE( gauge.get_time_weighted_mean() );
+
+    auto t0 = acc::Gauge::CLOCK_TP::now();
+    gauge.poll( t0 );
+
+    // 10 for 3 seconds, then 2 for 1 second
+    level = 2;
+    gauge.poll( t0 + std::chrono::seconds( 3 ) );
+    gauge.flush( t0 + std::chrono::seconds( 4 ) );
+
+    ASSERT_NEAR( gauge.get_time_weighted_mean().value(), 8.0, 1e-9 );
+    ASSERT_EQ( gauge.get_accumulator().get_min().value(), 2 );
+    ASSERT_EQ( gauge.get_accumulator().get_max().value(), 10 );
+    ASSERT_EQ( gauge.last_value().value(), 2 );
+    ASSERT_EQ( gauge.get_quantile( 0 ).value(), 2 );
+    ASSERT_EQ( gauge.get_quantile( 1 ).value(), 10 );
+}
+
+/*************************************************************/
+/*          One thread polls every gauge                     */
+/*************************************************************/
+TEST( Gauge_Poller, Polling )
+{
+    std::atomic<int> calls_a { 0 };
+    std::atomic<int> calls_b { 0 };
+
+    acc::Gauge_Poller poller( std::chrono::milliseconds( 2 ) );
+    auto& gauge_a = poller.add_gauge( "A", "", [&calls_a](){ return (double)( calls_a++ % 4 ); } );
+    auto& gauge_b = poller.add_gauge( "B", "", [&calls_b](){ calls_b++; return 5.0; } );
+
+    poller.start();
+    std::this_thread::sleep_for( std::chrono::milliseconds( 60 ) );
+    poller.stop();
+
+    ASSERT_GT( calls_a.load(), 5 );
+    ASSERT_EQ( calls_a.load(), calls_b.load() );
+    ASSERT_NEAR( gauge_b.get_time_weighted_mean().value(), 5.0, 1e-9 );
+    ASSERT_GE( gauge_a.get_accumulator().get_max().value(), 3 );
+    ASSERT_NE( poller.toLogString().find( "A TWA" ), std::string::npos );
+
+    // Stopped means stopped
+    const int frozen = calls_a.load();
+    std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+    ASSERT_EQ( calls_a.load(), frozen );
+}
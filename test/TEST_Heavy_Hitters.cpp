@@ -0,0 +1,90 @@
+/**
+ * @file    TEST_Heavy_Hitters.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <random>
+#include <string>
+
+// Project Libraries
+#include <lib-acc/Heavy_Hitters.hpp>
+
+/*************************************************************/
+/*          Exact while the keys fit                         */
+/*************************************************************/
+TEST( Heavy_Hitters, Under_Capacity )
+{
+    auto acc = acc::Heavy_Hitters<std::string>::create( 4, "ms" );
+    for( int i = 0; i < 10; i++ )
+    {
+        acc.insert( "a", 1 );
+    }
+    acc.insert( "b", 5 );
+    acc.insert( "b", 7 );
+
+    auto top = acc.get_top();
+    ASSERT_EQ( top.size(), 2 );
+    ASSERT_EQ( top[0].key, "a" );
+    ASSERT_EQ( top[0].rank, 10 );
+    ASSERT_EQ( top[0].error, 0 );
+    ASSERT_EQ( top[1].key, "b" );
+    ASSERT_DOUBLE_EQ( top[1].stats.mean().value(), 6 );
+    ASSERT_EQ( acc.get_other().count, 0 );
+}
+
+/*************************************************************/
+/*          Dominant keys survive a long tail                */
+/*************************************************************/
+TEST( Heavy_Hitters, Long_Tail )
+{
+    auto acc = acc::Heavy_Hitters<int>::create( 20, "ms" );
+
+    std::mt19937 rng( 3 );
+    std::uniform_int_distribution<int> tail( 100, 100000 );
+    for( int i = 0; i < 100000; i++ )
+    {
+        // Keys 0-2 are 10% of the stream each, the rest is spread thin
+        int key = ( i % 10 < 3 ) ? ( i % 10 ) : tail( rng );
+        acc.insert( key, 1 );
+    }
+
+    auto top = acc.get_top( 3 );
+    ASSERT_EQ( top.size(), 3 );
+    for( const auto& entry : top )
+    {
+        ASSERT_LT( entry.key, 3 );
+        ASSERT_GE( entry.rank - entry.error, 0 );
+        ASSERT_LE( entry.rank - entry.error, 10000 );
+        ASSERT_GE( entry.rank, 10000 );
+    }
+
+    // Tracked keys plus other cover every sample
+    int64_t tracked = 0;
+    for( const auto& entry : acc.get_top() )
+    {
+        tracked += entry.stats.count;
+    }
+    ASSERT_EQ( tracked + acc.get_other().count, 100000 );
+    ASSERT_EQ( acc.get_total().count, 100000 );
+    ASSERT_EQ( acc.size(), 20 );
+}
+
+/*************************************************************/
+/*          Rank by total cost instead of count              */
+/*************************************************************/
+TEST( Heavy_Hitters, Rank_By_Total )
+{
+    auto acc = acc::Heavy_Hitters<std::string>::create( 2, "ms", acc::Heavy_Hitter_Rank::TOTAL );
+    for( int i = 0; i < 100; i++ )
+    {
+        acc.insert( "frequent", 1 );
+    }
+    acc.insert( "expensive", 1000 );
+
+    auto top = acc.get_top( 1 );
+    ASSERT_EQ( top[0].key, "expensive" );
+    ASSERT_NE( acc.toLogString().find( "expensive Sum" ), std::string::npos );
+}
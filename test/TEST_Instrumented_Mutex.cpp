@@ -0,0 +1,189 @@
+/**
+ * @file    TEST_Instrumented_Mutex.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Project Libraries
+#include <lib-acc/Accumulator.hpp>
+#include <lib-acc/Instrumented_Mutex.hpp>
+#include <Blocking_Queue.hpp>
+
+/*************************************************************/
+/*          Uncontended locking only counts                  */
+/*************************************************************/
+TEST( Instrumented_Mutex, Uncontended )
+{
+    acc::Instrumented_Mutex<> mtx( 4 );
+    ASSERT_FALSE( mtx.get_contention_rate() );
+    ASSERT_TRUE( mtx.toLogString().empty() );
+
+    for( int i = 0; i < 8; i++ )
+    {
+        std::unique_lock<acc::Instrumented_Mutex<>> lck( mtx );
+    }
+    ASSERT_TRUE( mtx.try_lock() );
+    mtx.unlock();
+
+    ASSERT_EQ( mtx.get_acquisitions(), 9 );
+    ASSERT_EQ( mtx.get_contended(), 0 );
+    ASSERT_EQ( mtx.get_contention_rate().value(), 0 );
+    ASSERT_EQ( mtx.get_wait().get_count(), 0 );
+
+    // One hold in every four acquisitions is timed
+    ASSERT_EQ( mtx.get_hold().get_count(), 2 );
+}
+
+namespace {
+
+/// Number of callers that reached Counting_Mutex::lock()
+std::atomic<int> g_blocking_lockers { 0 };
+
+/**
+ * std::mutex which counts callers about to block in lock()
+*/
+struct Counting_Mutex
+{
+    void lock()
+    {
+        g_blocking_lockers++;
+        mtx.lock();
+    }
+
+    bool try_lock()
+    {
+        return mtx.try_lock();
+    }
+
+    void unlock()
+    {
+        mtx.unlock();
+    }
+
+    std::mutex mtx;
+};
+
+} // End of anonymous namespace
+
+/*************************************************************/
+/*          A blocked acquisition records its wait           */
+/*************************************************************/
+TEST( Instrumented_Mutex, Contended )
+{
+    acc::Instrumented_Mutex<Counting_Mutex> mtx( 1 );
+    g_blocking_lockers = 0;
+
+    mtx.lock();
+    std::thread waiter( [&mtx](){
+        std::scoped_lock lck( mtx );
+    });
+
+    // The inner lock() is only reached after a failed try_lock, so once the waiter gets
+    // there it is blocked until we unlock.  The hold after that bounds its wait from below.
+    while( g_blocking_lockers.load() == 0 )
+    {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+    ASSERT_FALSE( mtx.try_lock() );
+    mtx.unlock();
+    waiter.join();
+
+    ASSERT_EQ( mtx.get_acquisitions(), 2 );
+    ASSERT_EQ( mtx.get_contended(), 1 );
+    ASSERT_EQ( mtx.get_wait().get_count(), 1 );
+    ASSERT_GE( mtx.get_wait().get_max().value().count(), 10000 );
+    ASSERT_GE( mtx.get_hold().get_max().value().count(), 10000 );
+    ASSERT_NE( mtx.toLogString().find( "Contention Rate" ), std::string::npos );
+}
+
+/*************************************************************/
+/*          Works in place of std::mutex                     */
+/*************************************************************/
+TEST( Instrumented_Mutex, Drop_In )
+{
+    auto acc = acc::Accumulator<acc::FULL_FEATURE_SET, double, void, acc::Instrumented_Mutex<>>::create( "ms" );
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < 4; t++ )
+    {
+        threads.emplace_back( [&acc](){
+            for( int i = 0; i < 1000; i++ )
+            {
+                acc.insert( i );
+            }
+        });
+    }
+    for( auto& thread : threads )
+    {
+        thread.join();
+    }
+    ASSERT_EQ( acc.get_count().value(), 4000 );
+    ASSERT_GE( acc.get_mutex().get_acquisitions(), 4000 );
+
+    // Condition variables need the generic variant
+    acc::Instrumented_Mutex<> mtx;
+    std::condition_variable_any ready;
+    bool flag = false;
+    std::thread setter( [&](){
+        std::scoped_lock lck( mtx );
+        flag = true;
+        ready.notify_one();
+    });
+    {
+        std::unique_lock lck( mtx );
+        ready.wait( lck, [&flag](){ return flag; } );
+    }
+    setter.join();
+    ASSERT_TRUE( flag );
+}
+
+/*************************************************************/
+/*          Instruments a Blocking_Queue                     */
+/*************************************************************/
+TEST( Instrumented_Mutex, Blocking_Queue )
+{
+    Blocking_Queue<int,acc::Instrumented_Mutex<>> queue;
+
+    int64_t total = 0;
+    std::thread consumer( [&](){
+        int item;
+        while( queue.pop( item ) )
+        {
+            total += item;
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for( int t = 0; t < 4; t++ )
+    {
+        producers.emplace_back( [&queue](){
+            for( int i = 1; i <= 1000; i++ )
+            {
+                queue.push( i );
+            }
+        });
+    }
+    for( auto& producer : producers )
+    {
+        producer.join();
+    }
+    queue.done();
+    consumer.join();
+
+    ASSERT_EQ( total, 4 * 500500 );
+    ASSERT_TRUE( queue.empty() );
+
+    // Every push and pop took the lock at least once
+    ASSERT_GE( queue.get_mutex().get_acquisitions(), 8000 );
+    ASSERT_EQ( queue.get_mutex().get_wait().get_count(), queue.get_mutex().get_contended() );
+}
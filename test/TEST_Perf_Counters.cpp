@@ -0,0 +1,104 @@
+/**
+ * @file    TEST_Perf_Counters.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <vector>
+
+// Project Libraries
+#include <lib-acc/Perf_Counters.hpp>
+
+/*************************************************************/
+/*          Counters only move forward                       */
+/*************************************************************/
+TEST( Perf_Counters, Reading )
+{
+    auto& group = acc::perf::Perf_Counter_Group::thread_group();
+    auto begin = group.read();
+
+    volatile double sink = 0;
+    for( int i = 0; i < 1000000; i++ )
+    {
+        sink = sink + i * 0.5;
+    }
+    auto end = group.read();
+
+    for( size_t i = 0; i < acc::perf::PERF_EVENT_COUNT; i++ )
+    {
+        auto event = (acc::perf::Perf_Event)i;
+        ASSERT_EQ( begin.has( event ), group.is_available( event ) );
+        if( begin.has( event ) && end.has( event ) )
+        {
+            ASSERT_GE( end.value( event ), begin.value( event ) ) << acc::perf::to_string( event );
+        }
+    }
+    if( group.is_available( acc::perf::Perf_Event::TASK_CLOCK ) )
+    {
+        ASSERT_GT( end.value( acc::perf::Perf_Event::TASK_CLOCK ), begin.value( acc::perf::Perf_Event::TASK_CLOCK ) );
+    }
+}
+
+/*************************************************************/
+/*          Scopes feed the region, with or without PMUs     */
+/*************************************************************/
+TEST( Perf_Counters, Region )
+{
+    auto region = acc::perf::Perf_Region<>::create( "Fill" );
+    for( int pass = 0; pass < 5; pass++ )
+    {
+        acc::perf::Perf_Scope<> scope( region );
+        std::vector<int> values( 100000, pass );
+    }
+
+    ASSERT_EQ( region.get_wall_time().number_items_inserted(), 5 );
+    ASSERT_NE( region.toLogString().find( "Fill Wall Time" ), std::string::npos );
+
+    const auto& group = acc::perf::Perf_Counter_Group::thread_group();
+    for( size_t i = 0; i < acc::perf::PERF_EVENT_COUNT; i++ )
+    {
+        auto event = (acc::perf::Perf_Event)i;
+        ASSERT_EQ( region.get_event( event ).number_items_inserted(), group.is_available( event ) ? 5 : 0 );
+    }
+    if( group.is_available( acc::perf::Perf_Event::CYCLES ) && group.is_available( acc::perf::Perf_Event::INSTRUCTIONS ) )
+    {
+        ASSERT_GT( region.get_ipc().get_mean().value(), 0 );
+    }
+}
+
+/*************************************************************/
+/*          Counters reading backwards are dropped           */
+/*************************************************************/
+TEST( Perf_Counters, Backwards_Delta )
+{
+    using acc::perf::Perf_Event;
+    auto region = acc::perf::Perf_Region<>::create( "Scaled" );
+
+    acc::perf::Perf_Reading begin;
+    acc::perf::Perf_Reading end;
+    for( auto event : { Perf_Event::CYCLES, Perf_Event::INSTRUCTIONS, Perf_Event::LLC_MISSES } )
+    {
+        begin.available[(int)event] = true;
+        end.available[(int)event]   = true;
+    }
+    begin.values[(int)Perf_Event::CYCLES]       = 1000;
+    end.values[(int)Perf_Event::CYCLES]         = 3000;
+    begin.values[(int)Perf_Event::INSTRUCTIONS] = 5000;
+    end.values[(int)Perf_Event::INSTRUCTIONS]   = 4000;
+    begin.values[(int)Perf_Event::LLC_MISSES]   = 10;
+    end.values[(int)Perf_Event::LLC_MISSES]     = 12;
+    region.record( begin, end, std::chrono::milliseconds( 1 ) );
+
+    ASSERT_DOUBLE_EQ( region.get_event( Perf_Event::CYCLES ).get_mean().value(), 2000 );
+    ASSERT_EQ( region.get_event( Perf_Event::INSTRUCTIONS ).number_items_inserted(), 0 );
+    ASSERT_EQ( region.get_ipc().number_items_inserted(), 0 );
+    ASSERT_EQ( region.get_llc_miss_rate().number_items_inserted(), 0 );
+
+    // Forward again
+    end.values[(int)Perf_Event::INSTRUCTIONS] = 9000;
+    region.record( begin, end, std::chrono::milliseconds( 1 ) );
+    ASSERT_DOUBLE_EQ( region.get_ipc().get_mean().value(), 2 );
+    ASSERT_DOUBLE_EQ( region.get_llc_miss_rate().get_mean().value(), 0.5 );
+}
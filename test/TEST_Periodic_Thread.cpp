@@ -0,0 +1,95 @@
+/**
+ * @file    TEST_Periodic_Thread.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Project Libraries
+#include <lib-acc/Periodic_Thread.hpp>
+
+using namespace std::chrono_literals;
+
+/*************************************************************/
+/*          Ticks until stopped, and stops promptly          */
+/*************************************************************/
+TEST( Periodic_Thread, Ticks )
+{
+    std::atomic<int> ticks { 0 };
+    acc::Periodic_Thread thread( 1ms, [&ticks](){ ticks++; } );
+    ASSERT_FALSE( thread.is_running() );
+    ASSERT_FALSE( thread.stop() );
+
+    thread.start();
+    thread.start();
+    while( ticks.load() < 5 )
+    {
+        std::this_thread::sleep_for( 1ms );
+    }
+    ASSERT_TRUE( thread.is_running() );
+    ASSERT_TRUE( thread.stop() );
+    const int stopped_at = ticks.load();
+
+    std::this_thread::sleep_for( 5ms );
+    ASSERT_EQ( ticks.load(), stopped_at );
+    ASSERT_FALSE( thread.stop() );
+
+    // Restartable
+    thread.start();
+    while( ticks.load() == stopped_at )
+    {
+        std::this_thread::sleep_for( 1ms );
+    }
+}
+
+/*************************************************************/
+/*          First tick can wait a period                     */
+/*************************************************************/
+TEST( Periodic_Thread, Tick_On_Start )
+{
+    std::atomic<int> eager { 0 };
+    std::atomic<int> lazy { 0 };
+    acc::Periodic_Thread eager_thread( 1h, [&eager](){ eager++; } );
+    acc::Periodic_Thread lazy_thread( 1h, [&lazy](){ lazy++; }, false );
+    eager_thread.start();
+    lazy_thread.start();
+    while( eager.load() == 0 )
+    {
+        std::this_thread::sleep_for( 1ms );
+    }
+
+    // Neither waits out its hour to stop
+    const auto start = std::chrono::steady_clock::now();
+    eager_thread.stop();
+    lazy_thread.stop();
+    ASSERT_LT( std::chrono::steady_clock::now() - start, 10s );
+    ASSERT_EQ( eager.load(), 1 );
+    ASSERT_EQ( lazy.load(), 0 );
+}
+
+/*************************************************************/
+/*          An overrunning tick skips grid points            */
+/*************************************************************/
+TEST( Periodic_Thread, Missed_Ticks )
+{
+    std::atomic<int> ticks { 0 };
+    acc::Periodic_Thread thread( 1ms, [&ticks](){
+        if( ticks++ == 0 )
+        {
+            std::this_thread::sleep_for( 20ms );
+        }
+    });
+    thread.start();
+    while( ticks.load() < 2 )
+    {
+        std::this_thread::sleep_for( 1ms );
+    }
+    thread.stop();
+    ASSERT_GE( thread.missed_ticks(), 10 );
+    ASSERT_EQ( thread.period(), 1ms );
+}
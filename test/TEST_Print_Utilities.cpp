@@ -0,0 +1,52 @@
+/**
+ * @file    TEST_Print_Utilities.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <chrono>
+#include <sstream>
+#include <string>
+
+// Project Libraries
+#include <lib-acc/Accumulator.hpp>
+#include <lib-acc/Print_Utilities.hpp>
+#include <lib-acc/Timing_Accumulator.hpp>
+
+/*************************************************************/
+/*          Only the requested, populated fields print       */
+/*************************************************************/
+TEST( Print_Utilities, Accumulator )
+{
+    auto acc = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "B" );
+
+    std::stringstream empty;
+    acc::print::print_summary<acc::print::pretty::Printer>( empty, "Size", acc, "B", 2 );
+    ASSERT_TRUE( empty.str().empty() );
+
+    acc.insert( 2 );
+    acc.insert( 4 );
+    std::stringstream sin;
+    acc::print::print_summary<acc::print::pretty::Printer>( sin, "Size", acc, "B", 2 );
+    ASSERT_NE( sin.str().find( "Size Mean" ), std::string::npos );
+    ASSERT_NE( sin.str().find( "4.00 B" ), std::string::npos );
+    ASSERT_EQ( sin.str().find( "Size Sum" ), std::string::npos );
+}
+
+/*************************************************************/
+/*          Timing accumulators print their durations        */
+/*************************************************************/
+TEST( Print_Utilities, Timing_Accumulator )
+{
+    auto timing = acc::Timing_Accumulator<std::chrono::duration<double,std::milli>>::create();
+    timing.insert( std::chrono::milliseconds( 3 ) );
+
+    std::stringstream sin;
+    acc::print::print_summary<acc::print::pretty::Printer>( sin, "Wait", timing, "ms", 1, acc::print::SUMMARY_ALL );
+    ASSERT_NE( sin.str().find( "Wait Mean" ), std::string::npos );
+    ASSERT_NE( sin.str().find( "Wait Max" ), std::string::npos );
+    ASSERT_NE( sin.str().find( "Wait Sum" ), std::string::npos );
+    ASSERT_NE( sin.str().find( "3.0 ms" ), std::string::npos );
+}
@@ -0,0 +1,161 @@
+/**
+ * @file    TEST_Rate_Feature.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <chrono>
+#include <string>
+
+// Project Libraries
+#include <lib-acc/Accumulator.hpp>
+
+typedef boost::accumulators::stats<acc::count_stat,
+                                   acc::mean_stat,
+                                   acc::rate_stat,
+                                   acc::time_weighted_mean_stat> RATE_TEST_SET;
+
+using namespace std::chrono_literals;
+
+/*************************************************************/
+/*          Steady stream gives exact rates                  */
+/*************************************************************/
+TEST( Rate_Feature, Steady_Stream )
+{
+    auto acc = acc::Accumulator<RATE_TEST_SET,double>::create_with_params( "MB", acc::rate_window = 0.5 );
+    ASSERT_TRUE( acc.has_rate() );
+
+    // 100 events/s of 2 MB each, for 10 seconds
+    const auto start = std::chrono::steady_clock::time_point() + 1000s;
+    for( int i = 0; i <= 1000; i++ )
+    {
+        acc.insert( 2.0, start + i * 10ms );
+    }
+
+    auto rate = acc.get_rate().value();
+    ASSERT_EQ( rate.count, 1001 );
+    ASSERT_NEAR( rate.span, 10, 1e-9 );
+    ASSERT_NEAR( rate.event_rate, 100, 1e-6 );
+    ASSERT_NEAR( rate.value_rate, 200, 1e-6 );
+    ASSERT_NEAR( rate.instant_event_rate, 100, 1e-6 );
+    ASSERT_NEAR( rate.instant_value_rate, 200, 1e-6 );
+
+    ASSERT_NEAR( rate.windowed_event_rate, 100, 1e-6 );
+    ASSERT_NEAR( rate.windowed_value_rate, 200, 1e-6 );
+
+    // Other features still see the values
+    ASSERT_EQ( acc.get_count().value(), 1001 );
+    ASSERT_NE( acc.toLogString().find( "Event Rate" ), std::string::npos );
+}
+
+/*************************************************************/
+/*          Windowed rate tracks a change, the total lags    */
+/*************************************************************/
+TEST( Rate_Feature, Windowed )
+{
+    auto acc = acc::Accumulator<RATE_TEST_SET,double>::create_with_params( "B", acc::rate_window = 1.0 );
+
+    // 10 seconds at 10 events/s, then 5 seconds at 100 events/s
+    auto now = std::chrono::steady_clock::time_point() + 1000s;
+    for( int i = 0; i < 100; i++ )
+    {
+        now += 100ms;
+        acc.insert( 1.0, now );
+    }
+    for( int i = 0; i < 500; i++ )
+    {
+        now += 10ms;
+        acc.insert( 1.0, now );
+    }
+
+    auto rate = acc.get_rate().value();
+    ASSERT_NEAR( rate.windowed_event_rate, 100, 2 );
+    ASSERT_LT( rate.event_rate, 45 );
+}
+
+/*************************************************************/
+/*          Unbiased when samples are as sparse as the window */
+/*************************************************************/
+TEST( Rate_Feature, Sparse )
+{
+    auto acc = acc::Accumulator<RATE_TEST_SET,double>::create_with_params( "B", acc::rate_window = 1.0 );
+
+    // One 3 B event per 0.9 s against a 1 s window
+    auto now = std::chrono::steady_clock::time_point() + 1000s;
+    for( int i = 0; i < 50; i++ )
+    {
+        now += 900ms;
+        acc.insert( 3.0, now );
+    }
+    auto rate = acc.get_rate().value();
+    ASSERT_NEAR( rate.windowed_event_rate, 1 / 0.9, 1e-9 );
+    ASSERT_NEAR( rate.windowed_value_rate, 3 / 0.9, 1e-9 );
+
+    // Pairs sharing a timestamp count as two events in the next interval
+    for( int i = 0; i < 50; i++ )
+    {
+        now += 1s;
+        acc.insert( 3.0, now );
+        acc.insert( 3.0, now );
+    }
+    rate = acc.get_rate().value();
+    ASSERT_NEAR( rate.windowed_event_rate, 2, 1e-6 );
+    ASSERT_NEAR( rate.windowed_value_rate, 6, 1e-6 );
+    ASSERT_EQ( rate.count, 150 );
+}
+
+/*************************************************************/
+/*          Untimed inserts don't count toward the rate      */
+/*************************************************************/
+TEST( Rate_Feature, Untimed )
+{
+    auto acc = acc::Accumulator<RATE_TEST_SET,double>::create( "B" );
+    acc.insert( 5.0 );
+    acc.insert( 5.0 );
+
+    ASSERT_EQ( acc.get_rate().value().count, 0 );
+    ASSERT_EQ( acc.get_rate().value().event_rate, 0 );
+    ASSERT_FALSE( acc.get_time_weighted_mean().has_value() );
+
+    // Not in the feature set
+    auto plain = acc::Accumulator<boost::accumulators::stats<acc::mean_stat>,double>::create( "B" );
+    ASSERT_FALSE( plain.has_rate() );
+    ASSERT_FALSE( plain.get_rate().has_value() );
+    ASSERT_FALSE( plain.has_time_weighted_mean() );
+}
+
+/*************************************************************/
+/*          Each level is weighted by how long it held       */
+/*************************************************************/
+TEST( Rate_Feature, Time_Weighted_Mean )
+{
+    auto acc = acc::Accumulator<RATE_TEST_SET,double>::create( "items" );
+    const auto start = std::chrono::steady_clock::time_point() + 1000s;
+
+    // 10 for 9 seconds, then 100 for 1 second
+    acc.insert( 10.0, start );
+    ASSERT_FALSE( acc.get_time_weighted_mean().has_value() );
+    acc.insert( 100.0, start + 9s );
+    acc.insert( 0.0, start + 10s );
+
+    ASSERT_NEAR( acc.get_time_weighted_mean().value(), 19, 1e-9 );
+    ASSERT_NEAR( acc.get_mean().value(), 110.0 / 3, 1e-9 );
+}
+
+/*************************************************************/
+/*          Weighted accumulators take timestamps too        */
+/*************************************************************/
+TEST( Rate_Feature, Weighted )
+{
+    auto acc = acc::Accumulator<RATE_TEST_SET,double,double>::create( "B" );
+    const auto start = std::chrono::steady_clock::time_point() + 1000s;
+    acc.insert( 4.0, start );
+    acc.insert( 4.0, start + 2s );
+    acc.insert( 4.0, 3.0 );
+
+    ASSERT_EQ( acc.get_rate().value().count, 2 );
+    ASSERT_NEAR( acc.get_rate().value().value_rate, 2, 1e-9 );
+    ASSERT_EQ( acc.number_items_inserted(), 3 );
+}
@@ -0,0 +1,111 @@
+/**
+ * @file    TEST_Record_Accumulator.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <thread>
+#include <vector>
+
+// Project Libraries
+#include <lib-acc/Record_Accumulator.hpp>
+
+typedef acc::Record_Accumulator<acc::Record_Field<"Duration",acc::FULL_FEATURE_SET,double>,
+                                acc::Record_Field<"Bytes",acc::FULL_FEATURE_SET,int64_t>,
+                                acc::Record_Field<"Ratio",acc::ROLLING_FEATURE_SET,double>> EVENT_RECORD_TP;
+
+/*************************************************************/
+/*          Each field sees its own column of values         */
+/*************************************************************/
+TEST( Record_Accumulator, Fields )
+{
+    auto acc = EVENT_RECORD_TP::create( { "ms" }, { "B" }, { "%", 4 } );
+    for( int i = 1; i <= 10; i++ )
+    {
+        acc.insert( i * 0.5, i * 1000, i );
+    }
+
+    ASSERT_EQ( acc.number_items_inserted(), 10 );
+    ASSERT_EQ( acc.get_count<0>().value(), 10 );
+    ASSERT_NEAR( acc.get_mean<0>().value(), 2.75, 1e-12 );
+    ASSERT_EQ( acc.get_sum<1>().value(), 55000 );
+    ASSERT_EQ( acc.get_max<1>().value(), 10000 );
+
+    // Rolling window of 4 over the last field
+    ASSERT_NEAR( acc.get_rolling_mean<2>().value(), 8.5, 1e-12 );
+    ASSERT_FALSE( acc.get_mean<2>() );
+
+    ASSERT_EQ( acc.get_field_name<1>(), "Bytes" );
+}
+
+/*************************************************************/
+/*          Fields can be looked up by name                  */
+/*************************************************************/
+TEST( Record_Accumulator, Named_Fields )
+{
+    auto acc = EVENT_RECORD_TP::create( { "ms" }, { "B" }, { "%", 4 } );
+    acc.insert( 1.0, 100, 10 );
+    acc.insert( 3.0, 300, 20 );
+
+    static_assert( EVENT_RECORD_TP::index_of<"Bytes">() == 1 );
+    ASSERT_EQ( acc.get_mean<"Duration">(), acc.get_mean<0>() );
+    ASSERT_NEAR( acc.get_mean<"Duration">().value(), 2.0, 1e-12 );
+    ASSERT_NEAR( acc.get_variance<"Duration">().value(), 1.0, 1e-12 );
+    ASSERT_EQ( acc.get_min<"Bytes">().value(), 100 );
+    ASSERT_EQ( acc.get_sum<"Bytes">().value(), 400 );
+    ASSERT_NEAR( acc.get_rolling_mean<"Ratio">().value(), 15.0, 1e-12 );
+    ASSERT_FALSE( acc.get_rolling_mean<"Duration">() );
+}
+
+/*************************************************************/
+/*          No values, no statistics                         */
+/*************************************************************/
+TEST( Record_Accumulator, Empty )
+{
+    auto acc = EVENT_RECORD_TP::create( { "ms" }, { "B" }, { "%" } );
+    ASSERT_FALSE( acc.get_mean<"Duration">() );
+    ASSERT_FALSE( acc.get_max<"Bytes">() );
+    ASSERT_FALSE( acc.get_variance<0>() );
+}
+
+/*************************************************************/
+/*          One report covers every field                    */
+/*************************************************************/
+TEST( Record_Accumulator, Report )
+{
+    auto acc = EVENT_RECORD_TP::create( { "ms" }, { "B" }, { "%" } );
+    acc.insert( 1, 2, 3 );
+
+    auto report = acc.toLogString();
+    ASSERT_NE( report.find( "Duration Mean" ), std::string::npos );
+    ASSERT_NE( report.find( "Bytes Sum" ), std::string::npos );
+    ASSERT_NE( report.find( "Ratio Rolling Mean" ), std::string::npos );
+}
+
+/*************************************************************/
+/*          Fields stay in step under concurrent inserts     */
+/*************************************************************/
+TEST( Record_Accumulator, Threads )
+{
+    auto acc = EVENT_RECORD_TP::create( { "ms" }, { "B" }, { "%" } );
+    std::vector<std::thread> workers;
+    for( int t = 0; t < 4; t++ )
+    {
+        workers.emplace_back( [&acc](){
+            for( int i = 0; i < 10000; i++ )
+            {
+                acc.insert( 1, 2, 3 );
+            }
+        });
+    }
+    for( auto& worker : workers )
+    {
+        worker.join();
+    }
+
+    ASSERT_EQ( acc.get_count<0>().value(), 40000 );
+    ASSERT_EQ( acc.get_count<1>().value(), 40000 );
+    ASSERT_EQ( acc.get_sum<1>().value(), 80000 );
+}
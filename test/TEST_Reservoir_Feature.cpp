@@ -0,0 +1,119 @@
+/**
+ * @file    TEST_Reservoir_Feature.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <set>
+#include <sstream>
+
+// Project Libraries
+#include <lib-acc/Accumulator.hpp>
+#include <lib-acc/Checkpoint.hpp>
+
+typedef boost::accumulators::stats<acc::count_stat,
+                                   acc::mean_stat,
+                                   acc::reservoir_stat> RESERVOIR_TEST_SET;
+
+/*********************************************************/
+/*          Test the reservoir before it is full         */
+/*********************************************************/
+TEST( Reservoir_Feature, Fill_Phase )
+{
+    auto acc = acc::Accumulator<RESERVOIR_TEST_SET,double>::create_with_params( "ms", acc::reservoir_size = 10 );
+    ASSERT_TRUE( acc.has_reservoir() );
+
+    for( int i = 0; i < 5; i++ )
+    {
+        acc.insert( i );
+    }
+    auto samples = acc.get_reservoir().value();
+    ASSERT_EQ( samples.size(), 5 );
+    for( int i = 0; i < 5; i++ )
+    {
+        ASSERT_EQ( samples[i], i );
+    }
+
+    std::stringstream sout;
+    acc.dump_reservoir( sout );
+    ASSERT_EQ( sout.str(), "0,1,2,3,4\n" );
+}
+
+/*******************************************************/
+/*          Test the reservoir stays uniform           */
+/*******************************************************/
+TEST( Reservoir_Feature, Uniform_Sample )
+{
+    const size_t K = 2000;
+    const int NUM_SAMPLES = 200000;
+    auto acc = acc::Accumulator<RESERVOIR_TEST_SET,double>::create_with_params( "ms", acc::reservoir_size = K );
+    for( int i = 0; i < NUM_SAMPLES; i++ )
+    {
+        acc.insert( i );
+    }
+
+    auto samples = acc.get_reservoir().value();
+    ASSERT_EQ( samples.size(), K );
+
+    // Values are distinct, so duplicates would mean a slot was double-filled
+    std::set<double> unique( samples.begin(), samples.end() );
+    ASSERT_EQ( unique.size(), K );
+
+    // Mean of a uniform sample of 0..N-1 has stddev of roughly N/sqrt(12 K)
+    double mean = std::accumulate( samples.begin(), samples.end(), 0.0 ) / K;
+    ASSERT_NEAR( mean, NUM_SAMPLES / 2.0, 5 * NUM_SAMPLES / std::sqrt( 12.0 * K ) );
+
+    // Late samples must make it in, not just the fill phase
+    size_t upper_half = std::count_if( samples.begin(), samples.end(), [&]( double v ){ return v >= NUM_SAMPLES / 2; } );
+    ASSERT_NEAR( (double)upper_half, K / 2.0, 5 * std::sqrt( K / 4.0 ) );
+}
+
+/**********************************************************/
+/*          Test the default feature sets are unaffected  */
+/**********************************************************/
+TEST( Reservoir_Feature, Not_Enabled )
+{
+    auto acc = acc::Accumulator<acc::FULL_FEATURE_SET,double>::create( "ms" );
+    acc.insert( 1 );
+    ASSERT_FALSE( acc.has_reservoir() );
+    ASSERT_FALSE( acc.get_reservoir() );
+}
+
+/*********************************************************/
+/*          Corrupt checkpoints are rejected           */
+/*********************************************************/
+TEST( Reservoir_Feature, Bad_Checkpoint )
+{
+    auto acc = acc::Accumulator<RESERVOIR_TEST_SET,double>::create_with_params( "ms", acc::reservoir_size = 10 );
+    for( int i = 0; i < 5; i++ )
+    {
+        acc.insert( i );
+    }
+    const auto bytes = acc::checkpoint::serialize( acc );
+
+    // Capacity and seen count lead the reservoir state
+    std::vector<char> prefix;
+    acc::archive::Binary_Output_Archive out( prefix, acc::checkpoint::FORMAT_VERSION );
+    out << (size_t)10 << (uint64_t)5;
+    const auto at = std::search( bytes.begin(), bytes.end(), prefix.begin(), prefix.end() ) - bytes.begin();
+    ASSERT_LT( at, bytes.size() );
+
+    for( size_t capacity : { size_t(0), size_t(3) } )
+    {
+        auto corrupt = bytes;
+        std::memcpy( corrupt.data() + at, &capacity, sizeof(capacity) );
+
+        auto restored = acc::Accumulator<RESERVOIR_TEST_SET,double>::create_with_params( "ms", acc::reservoir_size = 10 );
+        ASSERT_THROW( acc::checkpoint::deserialize( restored, corrupt ), std::runtime_error );
+        ASSERT_TRUE( restored.get_reservoir().value().empty() );
+
+        // Still usable after the failed restore
+        restored.insert( 1 );
+        ASSERT_EQ( restored.get_reservoir().value().size(), 1 );
+    }
+}
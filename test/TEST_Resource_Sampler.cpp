@@ -0,0 +1,68 @@
+/**
+ * @file    TEST_Resource_Sampler.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Project Libraries
+#include <lib-acc/Resource_Sampler.hpp>
+
+using acc::proc::Resource_Metric;
+
+/*************************************************************/
+/*          Parse a stat line with a tricky command name     */
+/*************************************************************/
+TEST( Resource_Sampler, Parse_Stat )
+{
+    // pid (comm) state ppid pgrp session tty tpgid flags minflt cminflt majflt ... num_threads
+    const char stat[] = "1234 (my) prog) S 1 1234 1234 0 -1 4194304 517 0 3 0 10 2 0 0 20 0 7 0 100 1000 200";
+
+    acc::proc::Resource_Reading reading;
+    acc::proc::detail::parse_stat( stat, sizeof(stat) - 1, reading );
+    ASSERT_EQ( reading.value( Resource_Metric::MINOR_FAULTS ), 517 );
+    ASSERT_EQ( reading.value( Resource_Metric::MAJOR_FAULTS ), 3 );
+    ASSERT_EQ( reading.value( Resource_Metric::THREADS ), 7 );
+
+    const char status[] = "Name:\tprog\nVmPeak:\t  2000 kB\nVmRSS:\t  1536 kB\nThreads:\t7\n";
+    int64_t rss_kb = 0;
+    ASSERT_TRUE( acc::proc::detail::find_status_value( status, sizeof(status) - 1, "VmRSS", rss_kb ) );
+    ASSERT_EQ( rss_kb, 1536 );
+    ASSERT_FALSE( acc::proc::detail::find_status_value( status, sizeof(status) - 1, "VmSwap", rss_kb ) );
+}
+
+/*************************************************************/
+/*          Live readings of this process                    */
+/*************************************************************/
+TEST( Resource_Sampler, Sampling )
+{
+    auto reading = acc::proc::read_resources();
+    ASSERT_TRUE( reading.has( Resource_Metric::VOLUNTARY_SWITCHES ) );
+#if defined(__linux__)
+    ASSERT_GT( reading.value( Resource_Metric::RSS ), 0 );
+    ASSERT_GE( reading.value( Resource_Metric::THREADS ), 1 );
+#endif
+
+    acc::proc::Resource_Sampler<> sampler( std::chrono::milliseconds( 5 ), 100 );
+    sampler.start();
+
+    // Touch fresh pages and sleep so the sampler has something to see
+    std::vector<char> pages( 8 << 20, 1 );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+    sampler.stop();
+
+    const auto& switches = sampler.get_metric( Resource_Metric::VOLUNTARY_SWITCHES );
+    ASSERT_GT( switches.number_items_inserted(), 2 );
+    ASSERT_LE( switches.get_rolling_count().value(), 100 );
+#if defined(__linux__)
+    ASSERT_GT( sampler.get_metric( Resource_Metric::MINOR_FAULTS ).get_rolling_sum().value(), 0 );
+    ASSERT_GE( sampler.get_metric( Resource_Metric::THREADS ).get_max().value(), 2 );
+    ASSERT_NE( sampler.toLogString().find( "RSS Mean" ), std::string::npos );
+    ASSERT_NE( sampler.toLogString().find( "RSS All-Time Max" ), std::string::npos );
+#endif
+}
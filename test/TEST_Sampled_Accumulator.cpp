@@ -0,0 +1,87 @@
+/**
+ * @file    TEST_Sampled_Accumulator.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <chrono>
+#include <cmath>
+#include <string>
+
+// Project Libraries
+#include <lib-acc/Sampled_Accumulator.hpp>
+
+/**************************************************/
+/*          Test deterministic 1-in-N sampling    */
+/**************************************************/
+TEST( Sampled_Accumulator, Every_Nth )
+{
+    auto acc = acc::Sampled_Accumulator<acc::FULL_FEATURE_SET,double>::create_every_nth( "ms", 10 );
+    for( int i = 0; i < 1000; i++ )
+    {
+        acc.insert( 2.0 );
+    }
+
+    ASSERT_EQ( acc.get_offered_count(), 1000 );
+    ASSERT_EQ( acc.get_sampled_count(), 100 );
+    ASSERT_DOUBLE_EQ( acc.get_effective_sampling_rate(), 0.1 );
+    ASSERT_NEAR( acc.get_estimated_sum(), 2000, 1e-9 );
+    ASSERT_NEAR( acc.get_estimated_count(), 1000, 1e-9 );
+    ASSERT_DOUBLE_EQ( acc.get_sampled_accumulator().get_mean().value(), 2.0 );
+
+    // No independent-sampling error bound for systematic sampling
+    ASSERT_TRUE( std::isnan( acc.get_estimated_sum_std_error() ) );
+
+    // Kept-sample stats are labelled apart from the scaled estimates
+    const auto report = acc.toLogString();
+    ASSERT_NE( report.find( "Est. Sum" ), std::string::npos );
+    ASSERT_NE( report.find( "Kept Count" ), std::string::npos );
+    ASSERT_NE( report.find( "Kept Sum" ), std::string::npos );
+    ASSERT_EQ( report.find( "StdErr" ), std::string::npos );
+}
+
+/****************************************************/
+/*          Test probabilistic sampling bounds      */
+/****************************************************/
+TEST( Sampled_Accumulator, Probabilistic )
+{
+    auto acc = acc::Sampled_Accumulator<acc::FULL_FEATURE_SET,double>::create_probabilistic( "ms", 0.05 );
+
+    const int NUM_SAMPLES = 200000;
+    for( int i = 0; i < NUM_SAMPLES; i++ )
+    {
+        acc.insert( (double)( i % 100 ) );
+    }
+    const double expected_sum = 99 * 100 / 2.0 * ( NUM_SAMPLES / 100 );
+
+    std::cout << acc.toLogString() << std::endl;
+    ASSERT_EQ( acc.get_offered_count(), NUM_SAMPLES );
+    ASSERT_NEAR( acc.get_effective_sampling_rate(), 0.05, 0.005 );
+    ASSERT_GT( acc.get_estimated_sum_std_error(), 0 );
+    ASSERT_NEAR( acc.get_estimated_sum(), expected_sum, 5 * acc.get_estimated_sum_std_error() );
+}
+
+/*************************************************/
+/*          Test adaptive rate limiting          */
+/*************************************************/
+TEST( Sampled_Accumulator, Rate_Limited )
+{
+    const double TARGET_RATE = 2000;
+    auto acc = acc::Sampled_Accumulator<acc::FULL_FEATURE_SET,double>::create_rate_limited( "ms",
+                                                                                            TARGET_RATE,
+                                                                                            std::chrono::milliseconds( 20 ) );
+
+    auto start = std::chrono::steady_clock::now();
+    while( std::chrono::steady_clock::now() - start < std::chrono::milliseconds( 500 ) )
+    {
+        acc.insert( 1.0 );
+    }
+
+    // Kept samples should be on the order of target_rate * 0.5 sec, far fewer than offered
+    ASSERT_LT( acc.get_sampling_probability(), 1.0 );
+    ASSERT_LT( acc.get_sampled_count(), TARGET_RATE * 0.5 * 4 );
+    ASSERT_GT( acc.get_offered_count(), acc.get_sampled_count() * 10 );
+    ASSERT_NEAR( acc.get_estimated_count(), acc.get_offered_count(), 0.1 * acc.get_offered_count() );
+}
@@ -0,0 +1,58 @@
+/**
+ * @file    TEST_Split_Stopwatch.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <chrono>
+#include <thread>
+
+// Project Libraries
+#include <lib-acc/Split_Stopwatch.hpp>
+#include <lib-acc/Stopwatch.hpp>
+
+/*************************************************************/
+/*          CPU clocks plug into Stopwatch                   */
+/*************************************************************/
+TEST( Split_Stopwatch, CPU_Clocks )
+{
+    acc::Stopwatch<acc::Thread_CPU_Clock>  thread_watch;
+    acc::Stopwatch<acc::Process_CPU_Clock> process_watch;
+
+    // Sleeping costs no CPU
+    std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+    ASSERT_LT( thread_watch.stop<std::chrono::microseconds>().count(), 20000 );
+
+    volatile double sink = 0;
+    for( int i = 0; i < 20000000; i++ )
+    {
+        sink = sink + i;
+    }
+    ASSERT_GT( thread_watch.stop<std::chrono::microseconds>().count(), 0 );
+    ASSERT_GE( process_watch.stop<std::chrono::microseconds>().count(),
+               thread_watch.stop<std::chrono::microseconds>().count() / 2 );
+}
+
+/*************************************************************/
+/*          Waiting shows up as off-CPU time                 */
+/*************************************************************/
+TEST( Split_Stopwatch, Off_CPU )
+{
+    auto timing = acc::Split_Timing_Accumulator<>::create();
+    for( int i = 0; i < 3; i++ )
+    {
+        acc::Split_Stopwatch stopwatch;
+        std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+        auto split = stopwatch.stop();
+        ASSERT_GE( split.wall, std::chrono::milliseconds( 20 ) );
+        ASSERT_EQ( split.off_cpu(), split.wall - split.cpu );
+        timing.insert( split );
+    }
+
+    ASSERT_EQ( timing.get_wall().get_count().value(), 3 );
+    ASSERT_GE( timing.get_off_cpu().get_mean().value(), 15 );
+    ASSERT_GT( timing.get_off_cpu_fraction().value(), 0.5 );
+    ASSERT_NE( timing.toLogString().find( "Off-CPU Fraction" ), std::string::npos );
+}
@@ -0,0 +1,187 @@
+/**
+ * @file    TEST_Task_Graph.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Demo Libraries
+#include <Task_Graph.hpp>
+
+/*************************************************************/
+/*          Values flow down a then() chain                  */
+/*************************************************************/
+TEST( Task_Graph, Then_Chain )
+{
+    Thread_Pool pool( 2 );
+    pool.init();
+
+    auto task = spawn( pool, [](){ return 2; } )
+        .then( []( const int& x ){ return x * 10; } )
+        .then( []( const int& x ){ return std::to_string( x ); } );
+    ASSERT_EQ( task.get(), "20" );
+
+    std::atomic<int> ran { 0 };
+    auto void_chain = spawn( pool, [&](){ ran++; } ).then( [&](){ ran++; return 7; } );
+    ASSERT_EQ( void_chain.get(), 7 );
+    ASSERT_EQ( ran, 2 );
+
+    pool.shutdown();
+}
+
+/*************************************************************/
+/*          A failure skips later stages and propagates      */
+/*************************************************************/
+TEST( Task_Graph, Then_Exception )
+{
+    Thread_Pool pool( 2 );
+    pool.init();
+
+    std::atomic<bool> continued { false };
+    auto task = spawn( pool, []() -> int { throw std::runtime_error( "stage 1" ); } )
+        .then( [&]( const int& x ){ continued = true; return x + 1; } )
+        .then( [&]( const int& x ){ continued = true; return x + 1; } );
+    ASSERT_THROW( task.get(), std::runtime_error );
+    ASSERT_FALSE( continued );
+
+    pool.shutdown();
+}
+
+/*************************************************************/
+/*          when_all keeps input order, rethrows first error */
+/*************************************************************/
+TEST( Task_Graph, When_All )
+{
+    Thread_Pool pool( 3 );
+    pool.init();
+
+    // Later inputs finish first
+    std::vector<Task<int>> tasks;
+    for( int i = 0; i < 5; i++ )
+    {
+        tasks.push_back( spawn( pool, [i](){
+            std::this_thread::sleep_for( std::chrono::milliseconds( 5 * ( 5 - i ) ) );
+            return i;
+        } ) );
+    }
+    ASSERT_EQ( when_all( pool, tasks ).get(), std::vector<int>( { 0, 1, 2, 3, 4 } ) );
+
+    // Input 1 fails after input 3, but it is still the one reported
+    std::vector<Task<int>> failing;
+    failing.push_back( spawn( pool, [](){ return 0; } ) );
+    failing.push_back( spawn( pool, []() -> int {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+        throw std::runtime_error( "first" );
+    } ) );
+    failing.push_back( spawn( pool, [](){ return 2; } ) );
+    failing.push_back( spawn( pool, []() -> int { throw std::logic_error( "second" ); } ) );
+    try
+    {
+        when_all( pool, failing ).get();
+        FAIL() << "when_all should have thrown";
+    }
+    catch( const std::runtime_error& e )
+    {
+        ASSERT_EQ( std::string( e.what() ), "first" );
+    }
+
+    // No inputs completes immediately
+    ASSERT_TRUE( when_all( pool, std::vector<Task<int>>() ).get().empty() );
+
+    pool.shutdown();
+}
+
+/*************************************************************/
+/*          when_any reports the first to finish             */
+/*************************************************************/
+TEST( Task_Graph, When_Any )
+{
+    Thread_Pool pool( 3 );
+    pool.init();
+
+    std::vector<Task<int>> tasks;
+    tasks.push_back( spawn( pool, [](){ std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) ); return 0; } ) );
+    tasks.push_back( spawn( pool, [](){ return 1; } ) );
+    tasks.push_back( spawn( pool, [](){ std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) ); return 2; } ) );
+    ASSERT_EQ( when_any( pool, tasks ).get(), 1 );
+
+    // No inputs fails instead of hanging
+    auto empty = when_any( pool, std::vector<Task<int>>() );
+    ASSERT_TRUE( empty.is_ready() );
+    ASSERT_THROW( empty.get(), std::invalid_argument );
+
+    when_all( pool, tasks ).wait();
+    pool.shutdown();
+}
+
+/*************************************************************/
+/*          Graph respects dependencies                      */
+/*************************************************************/
+TEST( Task_Graph, Graph_Order )
+{
+    Thread_Pool pool( 3 );
+    pool.init();
+
+    std::mutex mtx;
+    std::vector<std::string> order;
+    auto record = [&]( const std::string& name ){
+        return [&, name](){ std::unique_lock<std::mutex> lck( mtx ); order.push_back( name ); };
+    };
+
+    // a -> (b, c) -> d
+    Task_Graph graph( pool );
+    auto a = graph.add( record( "a" ) );
+    auto b = graph.add( record( "b" ), { a } );
+    auto c = graph.add( record( "c" ), { a } );
+    graph.add( record( "d" ), { b, c } );
+    ASSERT_THROW( graph.add( record( "x" ), { 10 } ), std::invalid_argument );
+    ASSERT_EQ( graph.size(), 4 );
+
+    graph.run().get();
+    ASSERT_EQ( order.size(), 4 );
+    ASSERT_EQ( order.front(), "a" );
+    ASSERT_EQ( order.back(), "d" );
+
+    // Frozen once launched
+    ASSERT_THROW( graph.run(), std::logic_error );
+    ASSERT_THROW( graph.add( record( "e" ) ), std::logic_error );
+
+    // An empty graph completes
+    Task_Graph empty( pool );
+    ASSERT_NO_THROW( empty.run().get() );
+
+    pool.shutdown();
+}
+
+/*************************************************************/
+/*          Dependents of a failed stage are skipped         */
+/*************************************************************/
+TEST( Task_Graph, Graph_Skip_On_Failure )
+{
+    Thread_Pool pool( 2 );
+    pool.init();
+
+    std::atomic<bool> dependent_ran { false };
+    std::atomic<bool> independent_ran { false };
+
+    Task_Graph graph( pool );
+    auto bad = graph.add( [](){ throw std::runtime_error( "bad stage" ); } );
+    auto mid = graph.add( [&](){ dependent_ran = true; }, { bad } );
+    graph.add( [&](){ dependent_ran = true; }, { mid } );
+    graph.add( [&](){ independent_ran = true; } );
+
+    ASSERT_THROW( graph.run().get(), std::runtime_error );
+    ASSERT_FALSE( dependent_ran );
+    ASSERT_TRUE( independent_ran );
+
+    pool.shutdown();
+}
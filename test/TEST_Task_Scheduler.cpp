@@ -0,0 +1,180 @@
+/**
+ * @file    TEST_Task_Scheduler.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <vector>
+
+// Demo Libraries
+#include <Task_Scheduler.hpp>
+#include <Thread_Pool.hpp>
+
+namespace {
+
+/**
+ * @brief Build a task which appends its id to the log when run
+*/
+Scheduled_Task Make_Task( std::vector<int>&                                 log,
+                          int                                               id,
+                          Task_Priority                                     priority,
+                          Scheduled_Task::Clock::time_point                 deadline = Scheduled_Task::Clock::time_point::max() )
+{
+    Scheduled_Task task;
+    task.func     = [&log, id](){ log.push_back( id ); };
+    task.priority = priority;
+    task.deadline = deadline;
+    return task;
+}
+
+/**
+ * @brief Pop everything, running each task
+*/
+void Drain( Task_Scheduler& scheduler )
+{
+    Scheduled_Task task;
+    while( scheduler.try_pop( task ) )
+    {
+        task.func();
+    }
+}
+
+} // End of anonymous namespace
+
+/*************************************************************/
+/*          Higher classes are served first                  */
+/*************************************************************/
+TEST( Task_Scheduler, Class_Order )
+{
+    std::vector<int> log;
+    Task_Scheduler scheduler;
+    scheduler.push( Make_Task( log, 3, Task_Priority::BACKGROUND ) );
+    scheduler.push( Make_Task( log, 2, Task_Priority::NORMAL ) );
+    scheduler.push( Make_Task( log, 1, Task_Priority::HIGH ) );
+    ASSERT_EQ( scheduler.size(), 3 );
+    ASSERT_EQ( scheduler.size( Task_Priority::HIGH ), 1 );
+
+    Drain( scheduler );
+    ASSERT_EQ( log, std::vector<int>( { 1, 2, 3 } ) );
+    ASSERT_TRUE( scheduler.empty() );
+}
+
+/*************************************************************/
+/*          Earliest deadline first, FIFO among ties         */
+/*************************************************************/
+TEST( Task_Scheduler, EDF_And_FIFO )
+{
+    const auto now = Scheduled_Task::Clock::now();
+    std::vector<int> log;
+    Task_Scheduler scheduler;
+
+    // No deadline runs after every deadline, in submission order
+    scheduler.push( Make_Task( log, 5, Task_Priority::NORMAL ) );
+    scheduler.push( Make_Task( log, 3, Task_Priority::NORMAL, now + std::chrono::seconds( 3 ) ) );
+    scheduler.push( Make_Task( log, 1, Task_Priority::NORMAL, now + std::chrono::seconds( 1 ) ) );
+    scheduler.push( Make_Task( log, 6, Task_Priority::NORMAL ) );
+    scheduler.push( Make_Task( log, 2, Task_Priority::NORMAL, now + std::chrono::seconds( 1 ) ) );
+    scheduler.push( Make_Task( log, 4, Task_Priority::NORMAL, now + std::chrono::seconds( 3 ) ) );
+
+    Drain( scheduler );
+    ASSERT_EQ( log, std::vector<int>( { 1, 2, 3, 4, 5, 6 } ) );
+}
+
+/*************************************************************/
+/*          A bypassed class is promoted at the limit        */
+/*************************************************************/
+TEST( Task_Scheduler, Starvation_Limit )
+{
+    std::vector<int> log;
+    Task_Scheduler scheduler( 2 );
+    scheduler.push( Make_Task( log, 100, Task_Priority::BACKGROUND ) );
+    for( int i = 0; i < 5; i++ )
+    {
+        scheduler.push( Make_Task( log, i, Task_Priority::HIGH ) );
+    }
+
+    Drain( scheduler );
+    ASSERT_EQ( log, std::vector<int>( { 0, 1, 100, 2, 3, 4 } ) );
+}
+
+/*************************************************************/
+/*          pop() blocks until work or done()                */
+/*************************************************************/
+TEST( Task_Scheduler, Done )
+{
+    Task_Scheduler scheduler;
+    auto waiter = std::async( std::launch::async, [&scheduler](){
+        Scheduled_Task task;
+        return scheduler.pop( task );
+    } );
+    scheduler.done();
+    ASSERT_FALSE( waiter.get() );
+}
+
+/*************************************************************/
+/*          Pool latencies, deadline misses and p99 order    */
+/*************************************************************/
+TEST( Task_Scheduler, Thread_Pool_Latency )
+{
+    Thread_Pool pool( 1 );
+    pool.init();
+
+    // Park the only worker so everything below queues up behind it
+    std::promise<void> release;
+    auto gate = release.get_future().share();
+    auto parked = pool.submit( [gate](){ gate.wait(); } );
+    while( pool.active_workers() == 0 )
+    {
+        std::this_thread::yield();
+    }
+
+    std::mutex mtx;
+    std::vector<Task_Priority> order;
+    std::vector<std::future<void>> futures;
+    auto record = [&]( Task_Priority priority ){
+        return [&mtx, &order, priority](){ std::unique_lock<std::mutex> lck( mtx ); order.push_back( priority ); };
+    };
+    for( int i = 0; i < 20; i++ )
+    {
+        futures.push_back( pool.submit_with( Task_Priority::BACKGROUND, std::nullopt, record( Task_Priority::BACKGROUND ) ) );
+    }
+    for( int i = 0; i < 5; i++ )
+    {
+        // Already late, so each one counts as a miss
+        futures.push_back( pool.submit_with( Task_Priority::HIGH,
+                                             std::chrono::steady_clock::now() - std::chrono::milliseconds( 1 ),
+                                             record( Task_Priority::HIGH ) ) );
+    }
+
+    release.set_value();
+    parked.get();
+    for( auto& f : futures )
+    {
+        f.get();
+    }
+    pool.shutdown();
+
+    // Every high-priority task ran before any background task that was queued first
+    ASSERT_EQ( order.size(), 25 );
+    for( int i = 0; i < 5; i++ )
+    {
+        ASSERT_EQ( order[i], Task_Priority::HIGH ) << i;
+    }
+
+    ASSERT_EQ( pool.deadline_misses( Task_Priority::HIGH ), 5 );
+    ASSERT_EQ( pool.deadline_misses( Task_Priority::BACKGROUND ), 0 );
+    ASSERT_EQ( pool.queue_latency( Task_Priority::HIGH ).get_count().value(), 5 );
+    ASSERT_EQ( pool.queue_latency( Task_Priority::BACKGROUND ).get_count().value(), 20 );
+    ASSERT_EQ( pool.task_latency( Task_Priority::NORMAL ).get_count().value(), 1 );
+
+    // High-priority worst case is no worse than the background worst case
+    ASSERT_LE( pool.queue_latency( Task_Priority::HIGH ).get_max().value(),
+               pool.queue_latency( Task_Priority::BACKGROUND ).get_max().value() );
+    ASSERT_LE( pool.task_latency( Task_Priority::HIGH ).get_max().value(),
+               pool.task_latency( Task_Priority::BACKGROUND ).get_max().value() );
+}
@@ -0,0 +1,54 @@
+/**
+ * @file    TEST_Timing_Accumulator.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <chrono>
+
+// Project Libraries
+#include <lib-acc/Timing_Accumulator.hpp>
+
+/******************************************************/
+/*          Test basic statistics in display units    */
+/******************************************************/
+TEST( Timing_Accumulator, Basic_Stats )
+{
+    auto acc = acc::Timing_Accumulator<>::create();
+    ASSERT_FALSE( acc.get_mean() );
+
+    acc.insert( std::chrono::milliseconds( 2 ) );
+    acc.insert( std::chrono::microseconds( 4000 ) );
+    acc.insert( std::chrono::nanoseconds( 6000000 ) );
+
+    std::cout << acc.toLogString() << std::endl;
+    ASSERT_EQ( acc.get_count(), 3 );
+    ASSERT_EQ( acc.get_sum_ns(), 12000000 );
+    ASSERT_DOUBLE_EQ( acc.get_mean().value().count(), 4.0 );
+    ASSERT_DOUBLE_EQ( acc.get_min().value().count(), 2.0 );
+    ASSERT_DOUBLE_EQ( acc.get_max().value().count(), 6.0 );
+    ASSERT_NEAR( acc.get_variance().value(), 8.0 / 3.0, 1e-12 );
+    ASSERT_DOUBLE_EQ( acc.last_entry().count(), 6.0 );
+}
+
+/*******************************************************/
+/*          Test that long-run totals stay exact       */
+/*******************************************************/
+TEST( Timing_Accumulator, Exact_Long_Run_Sum )
+{
+    auto timing_acc = acc::Timing_Accumulator<std::chrono::duration<double>>::create();
+
+    // A large offset plus a 1 ns wobble is exactly what double summation loses
+    const int64_t BASE_NS = 1000000007;
+    const int NUM_SAMPLES = 3000000;
+    for( int i = 0; i < NUM_SAMPLES; i++ )
+    {
+        timing_acc.insert_ns( BASE_NS + ( i % 2 ) );
+    }
+
+    const int64_t expected = BASE_NS * NUM_SAMPLES + NUM_SAMPLES / 2;
+    ASSERT_EQ( timing_acc.get_sum_ns(), expected );
+    ASSERT_NEAR( timing_acc.get_variance().value(), 0.25e-18, 1e-24 );
+}
@@ -0,0 +1,139 @@
+/**
+ * @file    TEST_Trace_Context.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// C++ Libraries
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <vector>
+
+// Project Libraries
+#include <lib-acc/Trace_Context.hpp>
+#include <Thread_Pool.hpp>
+
+using namespace std::chrono_literals;
+
+/*************************************************************/
+/*          Spans nest and restore the previous context      */
+/*************************************************************/
+TEST( Trace_Context, Nesting )
+{
+    ASSERT_EQ( acc::trace::current_context().span, nullptr );
+    {
+        acc::trace::Trace_Span request( "Request", 42 );
+        ASSERT_EQ( acc::trace::current_context().span, &request );
+        ASSERT_EQ( request.trace_id(), 42 );
+        {
+            acc::trace::Trace_Span child( "Parse" );
+            ASSERT_EQ( child.parent(), &request );
+            ASSERT_EQ( child.trace_id(), 42 );
+            acc::trace::Trace_Zone zone( "Tokenize" );
+            std::this_thread::sleep_for( 2ms );
+        }
+        ASSERT_EQ( acc::trace::current_context().span, &request );
+
+        auto parse = request.get_breakdown( "Parse" );
+        ASSERT_NE( parse, nullptr );
+        ASSERT_EQ( parse->get_count(), 1 );
+        ASSERT_GE( parse->get_sum().count(), 2 );
+        ASSERT_EQ( request.get_breakdown( "Tokenize" ), nullptr );
+    }
+    ASSERT_EQ( acc::trace::current_context().span, nullptr );
+
+    // Roots get distinct IDs
+    uint64_t first_id;
+    {
+        acc::trace::Trace_Span first( "A" );
+        first_id = first.trace_id();
+    }
+    acc::trace::Trace_Span second( "B" );
+    ASSERT_EQ( second.parent(), nullptr );
+    ASSERT_NE( second.trace_id(), first_id );
+}
+
+/*************************************************************/
+/*          Zones outside a span are no-ops                  */
+/*************************************************************/
+TEST( Trace_Context, No_Span )
+{
+    acc::trace::Trace_Zone zone( "Orphan" );
+    ASSERT_EQ( acc::trace::current_context().span, nullptr );
+}
+
+/*************************************************************/
+/*          Context handed to other threads, as the pool does    */
+/*************************************************************/
+TEST( Trace_Context, Fan_Out )
+{
+    acc::trace::Trace_Span request( "Request" );
+
+    std::vector<std::thread> workers;
+    const auto context = acc::trace::current_context();
+    for( int i = 0; i < 4; i++ )
+    {
+        const auto submitted = std::chrono::steady_clock::now();
+        workers.emplace_back( [context, submitted]()
+        {
+            ASSERT_EQ( acc::trace::current_context().span, nullptr );
+            acc::trace::Context_Guard guard( context );
+            context.span->record_queue_wait( std::chrono::steady_clock::now() - submitted );
+
+            acc::trace::Trace_Zone zone( "Work" );
+            acc::trace::Trace_Span nested( "Subtask" );
+            ASSERT_EQ( nested.parent(), context.span );
+            std::this_thread::sleep_for( 1ms );
+        } );
+    }
+    for( auto& worker : workers )
+    {
+        worker.join();
+    }
+
+    ASSERT_EQ( request.get_breakdown( "Work" )->get_count(), 4 );
+    ASSERT_EQ( request.get_breakdown( "Subtask" )->get_count(), 4 );
+    ASSERT_EQ( request.get_queue_wait().get_count(), 4 );
+
+    auto log = request.toLogString();
+    ASSERT_NE( log.find( "Request / Work" ), std::string::npos );
+    ASSERT_NE( log.find( "Request Queue Wait" ), std::string::npos );
+}
+
+/*************************************************************/
+/*          Thread_Pool tasks run under the submitter's span */
+/*************************************************************/
+TEST( Trace_Context, Thread_Pool )
+{
+    Thread_Pool pool( 2 );
+    pool.init();
+    {
+        acc::trace::Trace_Span request( "Request" );
+
+        std::vector<std::future<const acc::trace::Trace_Span*>> results;
+        for( int i = 0; i < 8; i++ )
+        {
+            results.push_back( pool.submit( [](){
+                acc::trace::Trace_Zone zone( "Work" );
+                std::this_thread::sleep_for( 1ms );
+                return (const acc::trace::Trace_Span*)acc::trace::current_context().span;
+            }));
+        }
+        for( auto& result : results )
+        {
+            ASSERT_EQ( result.get(), &request );
+        }
+
+        ASSERT_EQ( request.get_breakdown( "Work" )->get_count(), 8 );
+        ASSERT_GE( request.get_breakdown( "Work" )->get_sum().count(), 8 );
+        ASSERT_EQ( request.get_queue_wait().get_count(), 8 );
+    }
+
+    // Workers drop the context once the task is done
+    auto outside = pool.submit( [](){ return acc::trace::current_context().span; } );
+    ASSERT_EQ( outside.get(), nullptr );
+    pool.shutdown();
+}